@@ -1,7 +1,10 @@
 #pragma once
 
 #include <cassert>
+#include <concepts>
+#include <memory_resource>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <variant>
 
@@ -178,12 +181,28 @@ public:
     // Convert ANSI-containing text to HTML string.
     std::string
     convert(std::string_view input) {
+        std::string out;
+        convert_into(input, out);
+        return out;
+    }
+    // Same as above, but the output is allocated from 'memRes' (e.g. allocators::MonotonicArena)
+    std::pmr::string
+    convert(std::string_view input, std::pmr::memory_resource *memRes) {
+        std::pmr::string out(memRes);
+        convert_into(input, out);
+        return out;
+    }
+
+    // Appends the HTML to 'out', which can be any std::basic_string of char (allocator agnostic)
+    template <typename STR>
+    requires std::same_as<typename STR::value_type, char>
+    void
+    convert_into(std::string_view input, STR &out) {
         styling_ = _Styling_{};
         hyperlink_stack_.clear();
 
         // Reserve approx size
-        std::string out;
-        out.reserve(input.size() * 8);
+        out.reserve(out.size() + input.size() * 8);
 
         if (opts_.full_page) {
             out.append("<!doctype html>\n<html>\n<head>\n<meta charset=\"utf-8\"/>\n"sv);
@@ -248,20 +267,35 @@ public:
         // TODO: Gotta handle the else case somehow
         else {}
 
-        out.append(parse_and_emit(input));
+        parse_and_emit(input, out);
 
         if (opts_.full_page) { out += "\n</pre>\n</body>\n</html>\n"; }
-        return out;
     }
 
     std::string
     convert2_canvasDrawn(std::string_view input) {
+        std::string out;
+        convert2_canvasDrawn_into(input, out);
+        return out;
+    }
+    // Same as above, but the output is allocated from 'memRes' (e.g. allocators::MonotonicArena)
+    std::pmr::string
+    convert2_canvasDrawn(std::string_view input, std::pmr::memory_resource *memRes) {
+        std::pmr::string out(memRes);
+        convert2_canvasDrawn_into(input, out);
+        return out;
+    }
+
+    // Appends the HTML to 'out', which can be any std::basic_string of char (allocator agnostic)
+    template <typename STR>
+    requires std::same_as<typename STR::value_type, char>
+    void
+    convert2_canvasDrawn_into(std::string_view input, STR &out) {
         styling_ = _Styling_{};
         hyperlink_stack_.clear();
 
         // Reserve approx size
-        std::string out;
-        out.reserve(input.size() * 8);
+        out.reserve(out.size() + input.size() * 8);
 
         if (opts_.full_page) {
             out.append("<!doctype html>\n<html>\n<head>\n<meta charset=\"utf-8\"/>\n"sv);
@@ -321,10 +355,9 @@ public:
         // TODO: Gotta handle the else case somehow
         else {}
 
-        out.append(parse_and_emit(input));
+        parse_and_emit(input, out);
 
         if (opts_.full_page) { out += "\n</pre>\n</body>\n</html>\n"; }
-        return out;
     }
 
 private:
@@ -395,49 +428,41 @@ private:
     }
 
     // Emit text chunk with current styling into out, wrapping spans and hyperlink as needed.
+    template <typename STR>
     void
-    emit_text_segment(std::string_view text, std::string &out) {
+    emit_text_segment(std::string_view text, STR &out) {
         if (text.empty()) { return; }
 
-        // escape HTML
-        auto escapeHTML = [](std::string_view s) -> std::string {
-            std::string out;
-            out.reserve(s.size());
+        // escape HTML directly into 'out' (no intermediate strings)
+        auto appendEscapedHTML = [&](std::string_view s, bool newlinesToBr) -> void {
             for (unsigned char c : s) {
                 switch (c) {
                     case '&': out += "&amp;"; break;
                     case '<': out += "&lt;"; break;
                     case '>': out += "&gt;"; break;
                     case '"': out += "&quot;"; break;
+                    case '\n':
+                        if (newlinesToBr) { out += "<br>\n"; }
+                        else { out.push_back('\n'); }
+                        break;
                     default:
-                        // Keep tabs and newlines; they will be interpreted by wrapper HTML/CSS
+                        // Keep tabs; they will be interpreted by wrapper HTML/CSS
                         out.push_back(static_cast<char>(c));
                 }
             }
-            return out;
         };
 
-        std::string esc = escapeHTML(text);
-        if (opts_.convert_newlines_to_br) {
-            // convert \n to <br>\n
-            std::string replaced;
-            replaced.reserve(esc.size());
-            for (size_t i = 0; i < esc.size(); ++i) {
-                char c = esc[i];
-                if (c == '\n') { replaced += "<br>\n"; }
-                else { replaced += c; }
-            }
-            esc.swap(replaced);
-        }
         // wrap opening hyperlink tags if any
         for (const auto &href : hyperlink_stack_) {
             out += "<a href=\"";
-            out += escapeHTML(href);
+            appendEscapedHTML(href, false);
             out += "\" target=\"_blank\" rel=\"noopener noreferrer\">";
         }
 
 
-        if (auto style = styling_.build_stylingString(); not style.has_value()) { out += esc; }
+        if (auto style = styling_.build_stylingString(); not style.has_value()) {
+            appendEscapedHTML(text, opts_.convert_newlines_to_br);
+        }
         else {
             out += "<span";
 
@@ -446,7 +471,7 @@ private:
             out.push_back('\"');
 
             out.push_back('>');
-            out += esc;
+            appendEscapedHTML(text, opts_.convert_newlines_to_br);
             out += "</span>";
         }
 
@@ -460,10 +485,9 @@ private:
     //  - OSC 8 ; params ; URI ST  (hyperlink start/end)
     //  - OSC 0/2 ... ST (window title) -> ignore
     //  - other sequences -> ignore / skip until terminator
-    std::string
-    parse_and_emit(std::string_view input) {
-        std::string out;
-        out.reserve(input.size() * 8);
+    template <typename STR>
+    void
+    parse_and_emit(std::string_view input, STR &out) {
         size_t       i = 0, start_plain = 0;
         const size_t n = input.size();
 
@@ -623,7 +647,6 @@ private:
 
         // flush remainder
         if (start_plain < n) { emit_text_segment(input.substr(start_plain, n - start_plain), out); }
-        return out;
     }
 
     // Apply SGR parameters to current style (mutates styling)
@@ -5,6 +5,7 @@
 #include <string_view>
 
 #include <incstd/color/color_common.hpp>
+#include <incstd/core/numeric.hpp>
 
 
 namespace incom::standard::console {
@@ -161,14 +162,16 @@ get_fg(ANSI_Color16 const col) {
 }
 constexpr std::string
 get_fg(std::uint8_t const color_256) {
-    return std::string("\x1b[38;5;").append(std::to_string(static_cast<int>(color_256))).append("m");
+    std::string res("\x1b[38;5;");
+    numeric::append_integral(res, color_256).push_back('m');
+    return res;
 }
 constexpr std::string
 get_fg(std::uint8_t const r, std::uint8_t const g, std::uint8_t const b) {
     std::string res("\x1b[38;2;");
-    res.append(std::to_string(r)).push_back(';');
-    res.append(std::to_string(g)).push_back(';');
-    res.append(std::to_string(b)).push_back('m');
+    numeric::append_integral(res, r).push_back(';');
+    numeric::append_integral(res, g).push_back(';');
+    numeric::append_integral(res, b).push_back('m');
     return res;
 }
 constexpr std::string
@@ -183,14 +186,16 @@ get_bg(ANSI_Color16 const col) {
 }
 constexpr std::string
 get_bg(std::uint8_t const color_256) {
-    return std::string("\x1b[48;5;").append(std::to_string(static_cast<int>(color_256))).append("m");
+    std::string res("\x1b[48;5;");
+    numeric::append_integral(res, color_256).push_back('m');
+    return res;
 }
 constexpr std::string
 get_bg(std::uint8_t const r, std::uint8_t const g, std::uint8_t const b) {
     std::string res("\x1b[48;2;");
-    res.append(std::to_string(r)).push_back(';');
-    res.append(std::to_string(g)).push_back(';');
-    res.append(std::to_string(b)).push_back('m');
+    numeric::append_integral(res, r).push_back(';');
+    numeric::append_integral(res, g).push_back(';');
+    numeric::append_integral(res, b).push_back('m');
     return res;
 }
 constexpr std::string
@@ -273,29 +278,29 @@ public:
 
     constexpr SGR_builder &
     color_fg(std::uint8_t const color_256) & {
-        _res.append("\x1b[38;5;").append(std::to_string(static_cast<int>(color_256))).append("m");
+        numeric::append_integral(_res.append("\x1b[38;5;"), color_256).append("m");
         return *this;
     }
     constexpr SGR_builder &&
     color_fg(std::uint8_t const color_256) && {
-        _res.append("\x1b[38;5;").append(std::to_string(static_cast<int>(color_256))).append("m");
+        numeric::append_integral(_res.append("\x1b[38;5;"), color_256).append("m");
         return std::move(*this);
     }
 
     constexpr SGR_builder &
     color_fg(std::uint8_t const r, std::uint8_t const g, std::uint8_t const b) & {
         _res.append("\x1b[38;2;");
-        _res.append(std::to_string(r)).push_back(';');
-        _res.append(std::to_string(g)).push_back(';');
-        _res.append(std::to_string(b)).push_back('m');
+        numeric::append_integral(_res, r).push_back(';');
+        numeric::append_integral(_res, g).push_back(';');
+        numeric::append_integral(_res, b).push_back('m');
         return *this;
     }
     constexpr SGR_builder &&
     color_fg(std::uint8_t const r, std::uint8_t const g, std::uint8_t const b) && {
         _res.append("\x1b[38;2;");
-        _res.append(std::to_string(r)).push_back(';');
-        _res.append(std::to_string(g)).push_back(';');
-        _res.append(std::to_string(b)).push_back('m');
+        numeric::append_integral(_res, r).push_back(';');
+        numeric::append_integral(_res, g).push_back(';');
+        numeric::append_integral(_res, b).push_back('m');
         return std::move(*this);
     }
 
@@ -322,29 +327,29 @@ public:
 
     constexpr SGR_builder &
     color_bg(std::uint8_t const color_256) & {
-        _res.append("\x1b[48;5;").append(std::to_string(static_cast<int>(color_256))).append("m");
+        numeric::append_integral(_res.append("\x1b[48;5;"), color_256).append("m");
         return *this;
     }
     constexpr SGR_builder &&
     color_bg(std::uint8_t const color_256) && {
-        _res.append("\x1b[48;5;").append(std::to_string(static_cast<int>(color_256))).append("m");
+        numeric::append_integral(_res.append("\x1b[48;5;"), color_256).append("m");
         return std::move(*this);
     }
 
     constexpr SGR_builder &
     color_bg(std::uint8_t const r, std::uint8_t const g, std::uint8_t const b) & {
         _res.append("\x1b[48;2;");
-        _res.append(std::to_string(r)).push_back(';');
-        _res.append(std::to_string(g)).push_back(';');
-        _res.append(std::to_string(b)).push_back('m');
+        numeric::append_integral(_res, r).push_back(';');
+        numeric::append_integral(_res, g).push_back(';');
+        numeric::append_integral(_res, b).push_back('m');
         return *this;
     }
     constexpr SGR_builder &&
     color_bg(std::uint8_t const r, std::uint8_t const g, std::uint8_t const b) && {
         _res.append("\x1b[48;2;");
-        _res.append(std::to_string(r)).push_back(';');
-        _res.append(std::to_string(g)).push_back(';');
-        _res.append(std::to_string(b)).push_back('m');
+        numeric::append_integral(_res, r).push_back(';');
+        numeric::append_integral(_res, g).push_back(';');
+        numeric::append_integral(_res, b).push_back('m');
         return std::move(*this);
     }
 
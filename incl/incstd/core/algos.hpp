@@ -1,21 +1,129 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <execution>
 #include <functional>
 #include <limits>
+#include <optional>
 #include <ranges>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <incstd/core/concepts.hpp>
+#include <incstd/core/coroutines.hpp>
 
 
 namespace incom::standard::algos {
 
+namespace detail {
+// Contiguous ranges are split across the pool only when every thread gets at least this many elements
+constexpr inline size_t c_parMinMaxMinChunkSz = 256uz * 1024uz;
+
+// One 512 bit register worth of independent accumulators, no dependency between the lanes means that this vectorizes
+// into packed compare + blend (or packed min/max) for every arithmetic type. The SIMD variants below are this very
+// loop compiled for wider instruction sets
+template <typename T>
+#if defined(__GNUC__) || defined(__clang__)
+[[gnu::always_inline]]
+#endif
+inline std::pair<T, T>
+_minMax_lanes(T const *data, size_t const sz) {
+    constexpr size_t c_laneCount = std::max(64uz / sizeof(T), 1uz);
+
+    std::array<T, c_laneCount> mins;
+    std::array<T, c_laneCount> maxs;
+    mins.fill(data[0]);
+    maxs.fill(data[0]);
+
+    size_t i = 0;
+    for (; i + c_laneCount <= sz; i += c_laneCount) {
+        for (size_t lane = 0; lane < c_laneCount; ++lane) {
+            T const val = data[i + lane];
+            mins[lane]  = val < mins[lane] ? val : mins[lane];
+            maxs[lane]  = maxs[lane] < val ? val : maxs[lane];
+        }
+    }
+    for (; i < sz; ++i) {
+        mins[0] = data[i] < mins[0] ? data[i] : mins[0];
+        maxs[0] = maxs[0] < data[i] ? data[i] : maxs[0];
+    }
+
+    std::pair<T, T> res{mins[0], maxs[0]};
+    for (size_t lane = 1; lane < c_laneCount; ++lane) {
+        res.first  = mins[lane] < res.first ? mins[lane] : res.first;
+        res.second = res.second < maxs[lane] ? maxs[lane] : res.second;
+    }
+    return res;
+}
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+template <typename T>
+[[gnu::target("avx2")]] std::pair<T, T>
+_minMax_avx2(T const *data, size_t const sz) {
+    return _minMax_lanes(data, sz);
+}
+template <typename T>
+[[gnu::target("avx512f,avx512bw")]] std::pair<T, T>
+_minMax_avx512(T const *data, size_t const sz) {
+    return _minMax_lanes(data, sz);
+}
+
+struct _X86Features {
+    bool hasAVX2;
+    bool hasAVX512;
+};
+inline _X86Features const &
+_x86_features() {
+    static _X86Features const res = [] {
+        __builtin_cpu_init();
+        return _X86Features{__builtin_cpu_supports("avx2") != 0,
+                            __builtin_cpu_supports("avx512f") != 0 && __builtin_cpu_supports("avx512bw") != 0};
+    }();
+    return res;
+}
+#endif
+
+// Picks the widest instruction set the CPU supports at runtime, 'sz' must not be 0
+template <typename T>
+std::pair<T, T>
+_minMax_dispatch(T const *data, size_t const sz) {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    if (_x86_features().hasAVX512) { return _minMax_avx512(data, sz); }
+    if (_x86_features().hasAVX2) { return _minMax_avx2(data, sz); }
+#endif
+    return _minMax_lanes(data, sz);
+}
+
+// Very large inputs are split into chunks reduced in parallel on the 'pool' (when supplied), 'sz' must not be 0
+template <typename T>
+std::pair<T, T>
+_minMax_contiguous(T const *data, size_t const sz, coroutines::ThreadPool *pool) {
+    size_t const chunkCount = pool == nullptr ? 1uz : std::min(pool->thread_count(), sz / c_parMinMaxMinChunkSz);
+    if (chunkCount < 2) { return _minMax_dispatch(data, sz); }
+
+    std::vector<std::pair<T, T>> partials(chunkCount);
+    coroutines::parallel_for(*pool, chunkCount, [&](size_t chunkID) {
+        size_t const from = sz * chunkID / chunkCount;
+        partials[chunkID] = _minMax_dispatch(data + from, sz * (chunkID + 1) / chunkCount - from);
+    });
+
+    std::pair<T, T> res = partials.front();
+    for (auto const &[minV, maxV] : partials) {
+        res.first  = std::min(res.first, minV);
+        res.second = std::max(res.second, maxV);
+    }
+    return res;
+}
+
 constexpr inline std::tuple<double, double>
-compute_minMaxMulti(auto &&anything) {
-    std::pair<double, double> res{std::numeric_limits<double>::max(), std::numeric_limits<double>::min()};
+_compute_minMaxMulti(auto const &anything, coroutines::ThreadPool *pool) {
+    std::pair<double, double> res{std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()};
 
     auto ol_set_solver = [&](this auto const &self, auto const &any) -> void {
         using any_t = std::remove_cvref_t<decltype(any)>;
@@ -25,7 +133,7 @@ compute_minMaxMulti(auto &&anything) {
             self(any.second);
         }
         else if constexpr (incom::standard::concepts::is_some_tuple<any_t>) {
-            std::invoke([&]<std::size_t... I>(std::index_sequence<I...>) { (self(std::get<I>), ...); },
+            std::invoke([&]<std::size_t... I>(std::index_sequence<I...>) { (self(std::get<I>(any)), ...); },
                         std::make_index_sequence<std::tuple_size_v<any_t>>{});
         }
         else if constexpr (incom::standard::concepts::is_some_optional<any_t> ||
@@ -37,6 +145,16 @@ compute_minMaxMulti(auto &&anything) {
         else if constexpr (std::ranges::range<any_t>) {
             using val_type = std::ranges::range_value_t<any_t>;
             if constexpr (std::is_arithmetic_v<val_type>) {
+                if constexpr (std::ranges::contiguous_range<any_t> && std::ranges::sized_range<any_t>) {
+                    if !consteval {
+                        if (std::ranges::empty(any)) { return; }
+                        auto [minV_l, maxV_l] =
+                            _minMax_contiguous(std::ranges::data(any), std::ranges::size(any), pool);
+                        res.first             = std::min(res.first, static_cast<double>(minV_l));
+                        res.second            = std::max(res.second, static_cast<double>(maxV_l));
+                        return;
+                    }
+                }
                 auto [minV_l, maxV_l] = std::ranges::minmax(any);
                 res.first             = std::min(res.first, static_cast<double>(minV_l));
                 res.second            = std::max(res.second, static_cast<double>(maxV_l));
@@ -55,96 +173,457 @@ compute_minMaxMulti(auto &&anything) {
     ol_set_solver(anything);
     return res;
 }
+} // namespace detail
 
-template <bool silentSkip = true>
+
+// Minimum and maximum of all arithmetic values found anywhere inside 'anything' (ranges, pairs, tuples, optionals ...)
+// Contiguous arithmetic ranges go through a SIMD kernel picked at runtime (AVX-512 / AVX2 / portable fallback)
+constexpr inline std::tuple<double, double>
+compute_minMaxMulti(auto &&anything) {
+    return detail::_compute_minMaxMulti(anything, nullptr);
+}
+
+// Overload: With an execution policy, anything other than 'std::execution::seq' also splits very large contiguous
+// ranges across the shared pool
+template <typename EP>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>>
+std::tuple<double, double>
+compute_minMaxMulti(EP &&, auto &&anything) {
+    return detail::_compute_minMaxMulti(anything, coroutines::pool_forPolicy<EP>());
+}
+
+namespace detail {
+// Top-level range elements per chunk when folding in parallel (every element might be a deep structure itself)
+constexpr inline size_t c_parDeepFoldMinChunkSz = 1024uz;
+
+// The first random access ranges found on the way down are split into chunks folded on the 'pool' (when supplied)
+// Chunks start with no value (so 'init' doesn't need to be an identity), partials are then folded into the result
+template <bool silentSkip>
 auto
-compute_deep_applyAndFold(auto const &&onto, auto const &&applier_func, auto const &&fold_func, auto init) {
-    using applier_func_t = std::remove_cv_t<decltype(applier_func)>;
-    using fold_func_t    = std::remove_cv_t<decltype(fold_func)>;
+_compute_deep_applyAndFold(auto const &onto, auto const &applier_func, auto const &fold_func, auto init,
+                           coroutines::ThreadPool *pool) {
+    using applier_func_t = decltype(applier_func);
+    using fold_func_t    = decltype(fold_func);
     using init_t         = std::remove_cv_t<decltype(init)>;
 
     if constexpr (not std::is_invocable_r_v<init_t, fold_func_t, init_t, init_t>) { static_assert(false); }
 
-    auto ol_set_solver = [&](this auto const &self, auto const &someOnto) -> void {
+    auto fold_into = [&](std::optional<init_t> &acc, init_t &&val) {
+        if (acc.has_value()) { *acc = fold_func(*acc, std::move(val)); }
+        else { acc.emplace(std::move(val)); }
+    };
+
+    auto ol_set_solver = [&](this auto const &self, auto const &someOnto, std::optional<init_t> &acc,
+                             bool const mayFork) -> void {
         using someOnto_t = std::remove_cvref_t<decltype(someOnto)>;
 
         // When we can invoke applier, we will
         if constexpr (std::is_invocable_r_v<init_t, applier_func_t, someOnto_t>) {
-            init = fold_func(init, applier_func(someOnto));
+            fold_into(acc, applier_func(someOnto));
         }
 
         else if constexpr (incom::standard::concepts::is_some_pair<someOnto_t>) {
-            self(someOnto.first);
-            self(someOnto.second);
+            self(someOnto.first, acc, mayFork);
+            self(someOnto.second, acc, mayFork);
         }
         else if constexpr (incom::standard::concepts::is_some_tuple<someOnto_t>) {
-            std::invoke([&]<std::size_t... I>(std::index_sequence<I...>) { (self(std::get<I>), ...); },
-                        std::make_index_sequence<std::tuple_size_v<someOnto_t>>{});
+            std::invoke(
+                [&]<std::size_t... I>(std::index_sequence<I...>) { (self(std::get<I>(someOnto), acc, mayFork), ...); },
+                std::make_index_sequence<std::tuple_size_v<someOnto_t>>{});
         }
         else if constexpr (incom::standard::concepts::is_some_optional<someOnto_t> ||
                            incom::standard::concepts::is_some_expected<someOnto_t>) {
-            if (someOnto.has_value()) { self(someOnto.value()); }
+            if (someOnto.has_value()) { self(someOnto.value(), acc, mayFork); }
+        }
+        else if constexpr (incom::standard::concepts::is_some_variant<someOnto_t>) {
+            std::visit([&](auto const &alternative) { self(alternative, acc, mayFork); }, someOnto);
         }
-        else if constexpr (incom::standard::concepts::is_some_variant<someOnto_t>) { std::visit(self, someOnto); }
 
+        else if constexpr (std::ranges::random_access_range<someOnto_t> && std::ranges::sized_range<someOnto_t>) {
+            size_t const sz         = std::ranges::size(someOnto);
+            size_t const chunkCount = (mayFork && pool != nullptr)
+                                          ? std::min(pool->thread_count() * 4, sz / c_parDeepFoldMinChunkSz)
+                                          : 1uz;
+            if (chunkCount < 2) {
+                for (auto const &rngItem : someOnto) { self(rngItem, acc, mayFork); }
+                return;
+            }
+
+            // No further forking inside of the chunks, these already run on the pool threads
+            std::vector<std::optional<init_t>> partials(chunkCount);
+            coroutines::parallel_for(*pool, chunkCount, [&](size_t chunkID) {
+                auto const beg = std::ranges::begin(someOnto);
+                for (size_t i = sz * chunkID / chunkCount; i < sz * (chunkID + 1) / chunkCount; ++i) {
+                    self(beg[i], partials[chunkID], false);
+                }
+            });
+            for (auto &partial : partials) {
+                if (partial.has_value()) { fold_into(acc, std::move(*partial)); }
+            }
+        }
         else if constexpr (std::ranges::range<someOnto_t>) {
-            for (auto const &rngItem : someOnto) { self(rngItem); }
+            for (auto const &rngItem : someOnto) { self(rngItem, acc, mayFork); }
         }
         else {
             if constexpr (not silentSkip) { static_assert(false); }
         }
     };
 
-    ol_set_solver(onto);
-    return init;
+    std::optional<init_t> res(std::move(init));
+    ol_set_solver(onto, res, true);
+    return std::move(*res);
+}
+} // namespace detail
+
+
+// Applies 'applier_func' to everything (however deep inside of 'onto') it can be applied to and folds the results
+// with 'fold_func' starting from 'init'
+template <bool silentSkip = true>
+auto
+compute_deep_applyAndFold(auto const &&onto, auto const &&applier_func, auto const &&fold_func, auto init) {
+    return detail::_compute_deep_applyAndFold<silentSkip>(onto, applier_func, fold_func, std::move(init), nullptr);
+}
+
+// Overload: With an execution policy, anything other than 'std::execution::seq' folds large random access ranges in
+// chunks on the shared pool. 'fold_func' must be associative and commutative, both functions safe to call concurrently
+template <bool silentSkip = true, typename EP>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>>
+auto
+compute_deep_applyAndFold(EP &&, auto const &&onto, auto const &&applier_func, auto const &&fold_func, auto init) {
+    return detail::_compute_deep_applyAndFold<silentSkip>(onto, applier_func, fold_func, std::move(init),
+                                                          coroutines::pool_forPolicy<EP>());
+}
+
+namespace detail {
+// Sorting runs shorter than this are not worth handing over to another thread
+constexpr inline size_t c_parSortMinRunSz = 16uz * 1024uz;
+
+// Keys are copied next to the index when they are small (good locality while sorting), larger ones are referenced
+template <typename RNG>
+using _argsort_key_t =
+    std::conditional_t<(std::is_trivially_copyable_v<std::ranges::range_value_t<RNG>> &&
+                        sizeof(std::ranges::range_value_t<RNG>) <= 2 * sizeof(void *)) ||
+                           not std::is_lvalue_reference_v<std::ranges::range_reference_t<RNG>>,
+                       std::ranges::range_value_t<RNG>, std::reference_wrapper<std::ranges::range_value_t<RNG> const>>;
+
+template <typename... RNGs>
+using _argsort_item_t = std::tuple<size_t, _argsort_key_t<RNGs>...>;
+
+template <typename KEY>
+constexpr decltype(auto)
+_unwrap_key(KEY const &key) {
+    if constexpr (incom::standard::concepts::is_specialization_of<KEY, std::reference_wrapper>) { return key.get(); }
+    else { return (key); }
+}
+
+// Indices bounded by the shortest of the ranges when all of them are sized (so that the buffer can be reserved)
+template <typename... RNGs>
+constexpr auto
+_argsort_idxRange(RNGs const &...rngs) {
+    if constexpr ((std::ranges::sized_range<RNGs> && ...)) {
+        return std::views::iota(0uz, std::min({static_cast<size_t>(std::ranges::size(rngs))...}));
+    }
+    else { return std::views::iota(0uz); }
+}
+
+template <typename... RNGs>
+struct _to_argsortItem {
+    constexpr _argsort_item_t<RNGs...>
+    operator()(auto const &zipTpl) const {
+        return std::apply([](size_t id, auto const &...keys) { return _argsort_item_t<RNGs...>(id, keys...); }, zipTpl);
+    }
+};
+
+// Number of elements of 'aIt' among the first 'diag' elements of the merged output ('merge path' split)
+// Ties go to 'aIt' same as in std::merge, so pieces of one merge can be merged independently
+template <typename IT, typename F_Less>
+constexpr size_t
+_mergePath_split(IT aIt, size_t aSz, IT bIt, size_t bSz, size_t diag, F_Less const &lessThan) {
+    size_t lo = diag > bSz ? diag - bSz : 0uz;
+    size_t hi = std::min(diag, aSz);
+    while (lo < hi) {
+        size_t const mid = lo + (hi - lo) / 2;
+        if (lessThan(bIt[diag - mid - 1], aIt[mid])) { hi = mid; }
+        else { lo = mid + 1; }
+    }
+    return lo;
+}
+
+// Parallel merge sort, every thread sorts one run, then neighbouring runs are merged pairwise
+// Each merge is cut into pieces along merge path diagonals, so all threads stay busy even in the last rounds
+template <typename T, typename F_Less>
+void
+_parallel_sort(std::vector<T> &items, F_Less const &lessThan, coroutines::ThreadPool &pool) {
+    size_t const itemCount = items.size();
+    size_t const thrCount  = pool.thread_count();
+    size_t       runCount  = std::min(thrCount, itemCount / c_parSortMinRunSz);
+    if (runCount < 2) {
+        std::ranges::sort(items, lessThan);
+        return;
+    }
+
+    std::vector<size_t> bounds(runCount + 1);
+    for (size_t i = 0; i <= runCount; ++i) { bounds[i] = itemCount * i / runCount; }
+    coroutines::parallel_for(pool, runCount, [&](size_t runID) {
+        std::sort(items.begin() + bounds[runID], items.begin() + bounds[runID + 1], lessThan);
+    });
+
+    struct _Piece {
+        size_t pairID;
+        size_t from; // Relative to the beginning of the pair
+        size_t to;
+    };
+    std::vector<T>      aux(items);
+    std::vector<T>     *src = &items;
+    std::vector<T>     *dst = &aux;
+    std::vector<_Piece> pieces;
+    while (runCount > 1) {
+        size_t const pairCount = (runCount + 1) / 2;
+        pieces.clear();
+        for (size_t pairID = 0; pairID < pairCount; ++pairID) {
+            size_t const pairSz     = bounds[std::min(2 * pairID + 2, runCount)] - bounds[2 * pairID];
+            size_t const pieceCount = std::max(1uz, pairSz * thrCount / itemCount);
+            for (size_t k = 0; k < pieceCount; ++k) {
+                pieces.push_back(_Piece{pairID, pairSz * k / pieceCount, pairSz * (k + 1) / pieceCount});
+            }
+        }
+
+        coroutines::parallel_for(pool, pieces.size(), [&](size_t pieceID) {
+            auto const [pairID, from, to] = pieces[pieceID];
+
+            size_t const aBeg = bounds[2 * pairID];
+            size_t const aEnd = bounds[std::min(2 * pairID + 1, runCount)];
+            size_t const bEnd = bounds[std::min(2 * pairID + 2, runCount)];
+            auto const   aIt  = src->begin() + aBeg;
+            auto const   bIt  = src->begin() + aEnd;
+
+            size_t const aFrom = _mergePath_split(aIt, aEnd - aBeg, bIt, bEnd - aEnd, from, lessThan);
+            size_t const aTo   = _mergePath_split(aIt, aEnd - aBeg, bIt, bEnd - aEnd, to, lessThan);
+            std::merge(aIt + aFrom, aIt + aTo, bIt + (from - aFrom), bIt + (to - aTo), dst->begin() + aBeg + from,
+                       lessThan);
+        });
+
+        for (size_t pairID = 0; pairID < pairCount; ++pairID) { bounds[pairID] = bounds[2 * pairID]; }
+        bounds[pairCount] = itemCount;
+        bounds.resize(pairCount + 1);
+        runCount = pairCount;
+        std::swap(src, dst);
+    }
+    if (src != &items) { items.swap(*src); }
+}
+
+// Radix sort path is taken for plain '<' or '>' over arithmetic keys only (no custom ordering to respect)
+template <typename COMP>
+constexpr inline bool _is_lessComp = std::same_as<COMP, std::less<>> || std::same_as<COMP, std::ranges::less>;
+template <typename COMP>
+constexpr inline bool _is_greaterComp = std::same_as<COMP, std::greater<>> || std::same_as<COMP, std::ranges::greater>;
+
+template <typename V>
+constexpr inline bool _is_radixKey = std::is_arithmetic_v<V> && sizeof(V) <= sizeof(uint64_t) &&
+                                     not std::same_as<std::remove_cv_t<V>, long double>;
+
+template <typename COMP, typename... RNGs>
+constexpr inline bool _is_radixSortable = (_is_lessComp<COMP> || _is_greaterComp<COMP>) &&
+                                          (_is_radixKey<std::ranges::range_value_t<RNGs>> && ...);
+
+template <size_t SZ>
+using _uint_ofSize_t = std::conditional_t<
+    SZ == 1, uint8_t, std::conditional_t<SZ == 2, uint16_t, std::conditional_t<SZ == 4, uint32_t, uint64_t>>>;
+
+// Maps the key onto an unsigned integer of the same size whose natural order is the order of the key
+// Floats: negative ones get all bits flipped, positive ones just the sign bit. Signed integers: sign bit flipped
+template <bool descending, typename V>
+constexpr _uint_ofSize_t<sizeof(V)>
+_radix_ukey(V const key) {
+    using U                  = _uint_ofSize_t<sizeof(V)>;
+    constexpr U const signBit = U{1} << (sizeof(U) * 8 - 1);
+
+    U res;
+    if constexpr (std::is_floating_point_v<V>) {
+        U const bits = std::bit_cast<U>(key);
+        res          = (bits & signBit) ? static_cast<U>(~bits) : static_cast<U>(bits | signBit);
+    }
+    else if constexpr (std::is_signed_v<V>) { res = static_cast<U>(static_cast<U>(key) ^ signBit); }
+    else { res = static_cast<U>(key); }
+
+    if constexpr (descending) { return static_cast<U>(~res); }
+    else { return res; }
+}
+
+// Where each key goes in the composite key, the last key is the least significant one
+// A key never straddles two words, word 0 is the least significant word
+struct _RadixSlot {
+    size_t wordID;
+    size_t shift;
+};
+template <typename... Vs>
+constexpr std::array<_RadixSlot, sizeof...(Vs)>
+_radix_layout() {
+    constexpr std::array<size_t, sizeof...(Vs)> bitSzs{(sizeof(Vs) * 8)...};
+
+    std::array<_RadixSlot, sizeof...(Vs)> res{};
+    size_t                                wordID = 0, usedBits = 0;
+    for (size_t k = sizeof...(Vs); k-- > 0;) {
+        if (usedBits + bitSzs[k] > 64) {
+            ++wordID;
+            usedBits = 0;
+        }
+        res[k]    = _RadixSlot{wordID, usedBits};
+        usedBits += bitSzs[k];
+    }
+    return res;
+}
+
+template <size_t WORDS>
+struct _RadixRecord {
+    std::array<uint64_t, WORDS> key;
+    size_t                      id;
+};
+
+// LSD radix sort on bytes of the composite key, all histograms are built in one read pass up front
+// Passes where all the records fall into one bucket (unused high bytes, narrow value ranges) are skipped entirely
+template <size_t WORDS>
+void
+_radix_sort(std::vector<_RadixRecord<WORDS>> &recs) {
+    constexpr size_t c_passCount = WORDS * sizeof(uint64_t);
+    if (recs.size() < 2) { return; }
+
+    std::vector<std::array<size_t, 256>> hists(c_passCount, std::array<size_t, 256>{});
+    for (auto const &rec : recs) {
+        for (size_t pass = 0; pass < c_passCount; ++pass) {
+            ++hists[pass][(rec.key[pass / sizeof(uint64_t)] >> (8 * (pass % sizeof(uint64_t)))) & 0xFF];
+        }
+    }
+
+    std::vector<_RadixRecord<WORDS>>  aux(recs.size());
+    std::vector<_RadixRecord<WORDS>> *src = &recs;
+    std::vector<_RadixRecord<WORDS>> *dst = &aux;
+    for (size_t pass = 0; pass < c_passCount; ++pass) {
+        auto &hist = hists[pass];
+        if (std::ranges::contains(hist, recs.size())) { continue; }
+
+        size_t offset = 0;
+        for (auto &bucket : hist) { offset += std::exchange(bucket, offset); }
+
+        size_t const wordID = pass / sizeof(uint64_t);
+        size_t const shift  = 8 * (pass % sizeof(uint64_t));
+        for (auto const &rec : *src) { (*dst)[hist[(rec.key[wordID] >> shift) & 0xFF]++] = rec; }
+        std::swap(src, dst);
+    }
+    if (src != &recs) { recs.swap(*src); }
 }
 
+// O(n) argsort for arithmetic keys, keys are packed into a composite unsigned key right during extraction
+template <bool descending, typename... Vs>
+std::vector<size_t>
+_radix_argsort(auto &&zipRng) {
+    constexpr auto   c_layout    = _radix_layout<Vs...>();
+    constexpr size_t c_wordCount = c_layout.front().wordID + 1;
+
+    std::vector<_RadixRecord<c_wordCount>> recs;
+    if constexpr (std::ranges::sized_range<decltype(zipRng)>) { recs.reserve(std::ranges::size(zipRng)); }
+    for (auto const &zipTpl : zipRng) {
+        _RadixRecord<c_wordCount> rec{{}, std::get<0>(zipTpl)};
+        [&]<size_t... ks>(std::index_sequence<ks...>) {
+            ((rec.key[c_layout[ks].wordID] |=
+              static_cast<uint64_t>(_radix_ukey<descending>(static_cast<Vs>(std::get<ks + 1>(zipTpl))))
+              << c_layout[ks].shift),
+             ...);
+        }(std::index_sequence_for<Vs...>{});
+        recs.push_back(rec);
+    }
+
+    _radix_sort(recs);
+    return std::views::transform(recs, [](auto const &rec) { return rec.id; }) | std::ranges::to<std::vector>();
+}
+
+// Extracts and sorts the items (in parallel when 'pool' is supplied) and returns just the indices
+// Arithmetic keys with plain '<' or '>' are radix sorted instead (sequentially, it is O(n) and memory bound anyway)
+template <typename... RNGs>
+std::vector<size_t>
+_argsort(auto &&zipRng, auto const &func_sorterComp, coroutines::ThreadPool *pool) {
+    using comp_t = std::remove_cvref_t<decltype(func_sorterComp)>;
+    if constexpr (_is_radixSortable<comp_t, RNGs...>) {
+        return _radix_argsort<_is_greaterComp<comp_t>, std::ranges::range_value_t<RNGs>...>(zipRng);
+    }
+    else {
+        auto items = std::forward<decltype(zipRng)>(zipRng) | std::views::transform(_to_argsortItem<RNGs...>{}) |
+                     std::ranges::to<std::vector>();
+
+        auto lessThan = [&]<size_t... idxs>(std::index_sequence<idxs...>) {
+            return [&](auto const &lhs, auto const &rhs) -> bool {
+                return std::invoke(func_sorterComp, std::tie(_unwrap_key(std::get<idxs + 1>(lhs))...),
+                                   std::tie(_unwrap_key(std::get<idxs + 1>(rhs))...));
+            };
+        }(std::index_sequence_for<RNGs...>{});
+
+        if (pool == nullptr) {
+            std::ranges::sort(items, lessThan);
+            return std::views::transform(items, [](auto const &tpl_item) { return std::get<0>(tpl_item); }) |
+                   std::ranges::to<std::vector>();
+        }
+
+        _parallel_sort(items, lessThan, *pool);
+        std::vector<size_t> res(items.size());
+        size_t const        chunkCount =
+            std::max(1uz, std::min(pool->thread_count(), items.size() / c_parSortMinRunSz));
+        coroutines::parallel_for(*pool, chunkCount, [&](size_t chunkID) {
+            for (size_t i = items.size() * chunkID / chunkCount; i < items.size() * (chunkID + 1) / chunkCount; ++i) {
+                res[i] = std::get<0>(items[i]);
+            }
+        });
+        return res;
+    }
+}
+} // namespace detail
+
+
 // Not actual sorting, just give the user sorted indices into original ranges.
 // func_sorterComp operates on tuples of <const & RNGs...> (through projection) but physically sorts tuples of
-// <size_t,std::reference_wrapper()...> Outputs sorted indices into the original rngs
+// <size_t, keys...> where small keys are copied and large ones referenced.
+// Arithmetic keys with std::less<> / std::greater<> (or the std::ranges ones) are radix sorted in O(n) instead
+// Outputs sorted indices into the original rngs
 template <typename... RNGs>
-requires(sizeof...(RNGs) > 0) && (std::ranges::range<RNGs>, ...)
+requires(sizeof...(RNGs) > 0) && (std::ranges::range<RNGs> && ...)
 std::vector<size_t>
 compute_sortedIDXs(auto func_sorterComp, RNGs const &...rngs) {
-    auto lam_IS = [&]<size_t... idxs>(std::index_sequence<idxs...>) -> std::vector<size_t> {
-        auto filteredVec = std::views::zip(std::views::iota(0uz), rngs...) | std::views::transform([](auto const &tpl) {
-                               return std::tuple(std::get<0>(tpl), std::ref(std::get<idxs + 1>(tpl))...);
-                           }) |
-                           std::ranges::to<std::vector>();
-
-        std::ranges::sort(filteredVec, func_sorterComp,
-                          [&](auto const &tpl) { return std::tie(std::get<idxs + 1>(tpl).get()...); });
-
-        return std::views::transform(filteredVec, [](auto const &tpl_item) { return std::get<0>(tpl_item); }) |
-               std::ranges::to<std::vector>();
-    };
+    return detail::_argsort<RNGs...>(std::views::zip(detail::_argsort_idxRange(rngs...), rngs...), func_sorterComp,
+                                     nullptr);
+}
 
-    return lam_IS(std::make_index_sequence<sizeof...(RNGs)>{});
+// Overload: With an execution policy, anything other than 'std::execution::seq' sorts in parallel on the shared pool
+// func_sorterComp must be safe to call concurrently
+template <typename EP, typename... RNGs>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>> && (sizeof...(RNGs) > 0) &&
+         (std::ranges::range<RNGs> && ...)
+std::vector<size_t>
+compute_sortedIDXs(EP &&, auto func_sorterComp, RNGs const &...rngs) {
+    return detail::_argsort<RNGs...>(std::views::zip(detail::_argsort_idxRange(rngs...), rngs...), func_sorterComp,
+                                     coroutines::pool_forPolicy<EP>());
 }
 
 // Not actual sorting, just give the user sorted indices into original ranges.
 // func_filter operates on tuples of <size_t, RNGs...>. Means the first element is automatically added to be the index.
 // func_sorterComp operates on tuples of <const & RNGs...> (through projection) but physically sorts tuples of <size_t,
-// std::reference_wrapper()...> Outputs sorted indices into the original rngs
+// keys...> where small keys are copied and large ones referenced. Outputs sorted indices into the original rngs
 template <typename... RNGs>
-requires(sizeof...(RNGs) > 0) && (std::ranges::range<RNGs>, ...)
+requires(sizeof...(RNGs) > 0) && (std::ranges::range<RNGs> && ...)
 std::vector<size_t>
 compute_filterSortedIDXs(auto func_filter, auto func_sorterComp, RNGs const &...rngs) {
-    auto lam_IS = [&]<size_t... idxs>(std::index_sequence<idxs...>) -> std::vector<size_t> {
-        auto filteredVec = std::views::zip(std::views::iota(0uz), rngs...) | std::views::filter(func_filter) |
-                           std::views::transform([](auto const &tpl) {
-                               return std::tuple(std::get<0>(tpl), std::ref(std::get<idxs + 1>(tpl))...);
-                           }) |
-                           std::ranges::to<std::vector>();
-
-        std::ranges::sort(filteredVec, func_sorterComp,
-                          [&](auto const &tpl) { return std::tie(std::get<idxs + 1>(tpl).get()...); });
-
-        return std::views::transform(filteredVec, [](auto const &tpl_item) { return std::get<0>(tpl_item); }) |
-               std::ranges::to<std::vector>();
-    };
+    return detail::_argsort<RNGs...>(
+        std::views::zip(detail::_argsort_idxRange(rngs...), rngs...) | std::views::filter(func_filter),
+        func_sorterComp, nullptr);
+}
 
-    return lam_IS(std::make_index_sequence<sizeof...(RNGs)>{});
+// Overload: With an execution policy, filtering stays sequential, sorting is parallel unless 'std::execution::seq'
+template <typename EP, typename... RNGs>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>> && (sizeof...(RNGs) > 0) &&
+         (std::ranges::range<RNGs> && ...)
+std::vector<size_t>
+compute_filterSortedIDXs(EP &&, auto func_filter, auto func_sorterComp, RNGs const &...rngs) {
+    return detail::_argsort<RNGs...>(
+        std::views::zip(detail::_argsort_idxRange(rngs...), rngs...) | std::views::filter(func_filter),
+        func_sorterComp, coroutines::pool_forPolicy<EP>());
 }
 
 
@@ -0,0 +1,303 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+
+namespace incom::standard::allocators {
+using namespace incom::standard;
+
+namespace detail {
+[[nodiscard]] constexpr size_t
+_align_up(size_t value, size_t alignment) noexcept {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+} // namespace detail
+
+
+// Monotonic 'bump pointer' arena usable as std::pmr::memory_resource
+// Deallocation is a no-op, everything is released at once by 'reset()' (or on destruction)
+// Unlike std::pmr::monotonic_buffer_resource the largest chunk is kept around on 'reset()' and reused, so repeated
+// runs (one solver run, one conversion ...) of similar size do not touch the upstream resource at all
+// Not thread safe
+class MonotonicArena : public std::pmr::memory_resource {
+    struct _ChunkHeader {
+        _ChunkHeader *prev;
+        size_t        size; // Including the header itself
+    };
+    static constexpr size_t c_headerSz = detail::_align_up(sizeof(_ChunkHeader), alignof(std::max_align_t));
+
+private:
+    std::pmr::memory_resource *_m_upstream;
+
+    _ChunkHeader *_m_chunks = nullptr; // Most recent chunk first
+    _ChunkHeader *_m_spare  = nullptr; // Kept from before the last 'reset()'
+    std::byte    *_m_cur    = nullptr;
+    std::byte    *_m_end    = nullptr;
+
+    std::byte *_m_initBuf = nullptr; // Not owned
+    size_t     _m_initSz  = 0;
+    size_t     _m_nextChunkSz;
+
+public:
+    explicit MonotonicArena(size_t initialChunkSz = 4096uz,
+                            std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+        : _m_upstream(upstream), _m_nextChunkSz(std::max(initialChunkSz, 2 * c_headerSz)) {}
+
+    // Uses (not owns) the supplied buffer first, only then goes to the upstream resource
+    MonotonicArena(void *buffer, size_t bufferSz, std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+        : _m_upstream(upstream), _m_cur(static_cast<std::byte *>(buffer)), _m_end(_m_cur + bufferSz),
+          _m_initBuf(_m_cur), _m_initSz(bufferSz), _m_nextChunkSz(std::max(bufferSz * 2, 2 * c_headerSz)) {}
+
+    //    NOT copiable or movable, containers hold pointers to it
+    MonotonicArena(MonotonicArena const &) = delete;
+    MonotonicArena &
+    operator=(MonotonicArena const &) = delete;
+
+    ~MonotonicArena() override { release(); }
+
+    // Everything allocated so far becomes invalid, keeps the largest chunk for reuse
+    void
+    reset() noexcept {
+        if (_m_chunks != nullptr) {
+            _ChunkHeader *toKeep = _m_chunks;
+            _free_chain(toKeep->prev);
+            toKeep->prev = nullptr;
+            if (_m_spare != nullptr && _m_spare->size > toKeep->size) { std::swap(toKeep, _m_spare); }
+            _free_chain(_m_spare);
+            _m_spare  = toKeep;
+            _m_chunks = nullptr;
+        }
+        _m_cur = _m_initBuf;
+        _m_end = _m_initBuf + _m_initSz;
+    }
+
+    // Everything allocated so far becomes invalid, returns all memory to upstream
+    void
+    release() noexcept {
+        _free_chain(_m_chunks);
+        _free_chain(_m_spare);
+        _m_chunks = nullptr;
+        _m_spare  = nullptr;
+        _m_cur    = _m_initBuf;
+        _m_end    = _m_initBuf + _m_initSz;
+    }
+
+    [[nodiscard]] std::pmr::memory_resource *
+    upstream_resource() const noexcept {
+        return _m_upstream;
+    }
+
+protected:
+    void *
+    do_allocate(size_t bytes, size_t alignment) override {
+        if (auto *res = _try_bump(bytes, alignment)) { return res; }
+        _grow(bytes, alignment);
+        return _try_bump(bytes, alignment);
+    }
+
+    void
+    do_deallocate(void *, size_t, size_t) override {}
+
+    bool
+    do_is_equal(std::pmr::memory_resource const &other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    void *
+    _try_bump(size_t bytes, size_t alignment) noexcept {
+        void  *ptr   = _m_cur;
+        size_t space = static_cast<size_t>(_m_end - _m_cur);
+        if (_m_cur == nullptr || std::align(alignment, bytes, ptr, space) == nullptr) { return nullptr; }
+        _m_cur = static_cast<std::byte *>(ptr) + bytes;
+        return ptr;
+    }
+
+    void
+    _grow(size_t bytes, size_t alignment) {
+        size_t const required = c_headerSz + bytes + alignment;
+
+        _ChunkHeader *chunk;
+        if (_m_spare != nullptr && _m_spare->size >= required) { chunk = std::exchange(_m_spare, nullptr); }
+        else {
+            size_t const chunkSz = std::max(_m_nextChunkSz, std::bit_ceil(required));
+            chunk = static_cast<_ChunkHeader *>(_m_upstream->allocate(chunkSz, alignof(std::max_align_t)));
+            chunk->size    = chunkSz;
+            _m_nextChunkSz = chunkSz * 2;
+        }
+        chunk->prev = _m_chunks;
+        _m_chunks   = chunk;
+        _m_cur      = reinterpret_cast<std::byte *>(chunk) + c_headerSz;
+        _m_end      = reinterpret_cast<std::byte *>(chunk) + chunk->size;
+    }
+
+    void
+    _free_chain(_ChunkHeader *chunk) noexcept {
+        while (chunk != nullptr) {
+            _ChunkHeader *const prev = chunk->prev;
+            _m_upstream->deallocate(chunk, chunk->size, alignof(std::max_align_t));
+            chunk = prev;
+        }
+    }
+};
+
+
+// Size class pool usable as std::pmr::memory_resource
+// Requests are rounded up to power of 2 size classes (16 B ... 4 KiB), freed blocks go to per class free lists and are
+// reused. Blocks are carved in batches from an internal MonotonicArena. Larger (or over-aligned) requests are passed
+// to the upstream resource, but are still tracked so that 'reset()' releases everything at once
+// Not thread safe
+class SizeClassPool : public std::pmr::memory_resource {
+    static constexpr size_t c_minClassSz   = 16uz;
+    static constexpr size_t c_maxClassSz   = 4096uz;
+    static constexpr size_t c_classCount   = std::countr_zero(c_maxClassSz) - std::countr_zero(c_minClassSz) + 1;
+    static constexpr size_t c_batchBytes   = 16uz * 1024uz;
+    static constexpr size_t c_maxAlignment = alignof(std::max_align_t);
+
+    struct _FreeNode {
+        _FreeNode *next;
+    };
+    struct _LargeHeader {
+        _LargeHeader *prev;
+        _LargeHeader *next;
+        size_t        bytes;
+        size_t        alignment;
+    };
+
+private:
+    std::array<_FreeNode *, c_classCount> _m_freeLists{};
+    MonotonicArena                        _m_arena;
+    _LargeHeader                         *_m_large = nullptr;
+
+public:
+    explicit SizeClassPool(std::pmr::memory_resource *upstream = std::pmr::new_delete_resource())
+        : _m_arena(c_batchBytes, upstream) {}
+
+    //    NOT copiable or movable, containers hold pointers to it
+    SizeClassPool(SizeClassPool const &) = delete;
+    SizeClassPool &
+    operator=(SizeClassPool const &) = delete;
+
+    ~SizeClassPool() override { release(); }
+
+    // Everything allocated so far becomes invalid, keeps the largest arena chunk for reuse
+    void
+    reset() noexcept {
+        _release_large();
+        _m_freeLists.fill(nullptr);
+        _m_arena.reset();
+    }
+
+    // Everything allocated so far becomes invalid, returns all memory to upstream
+    void
+    release() noexcept {
+        _release_large();
+        _m_freeLists.fill(nullptr);
+        _m_arena.release();
+    }
+
+    [[nodiscard]] std::pmr::memory_resource *
+    upstream_resource() const noexcept {
+        return _m_arena.upstream_resource();
+    }
+
+protected:
+    void *
+    do_allocate(size_t bytes, size_t alignment) override {
+        if (_is_large(bytes, alignment)) { return _allocate_large(bytes, alignment); }
+
+        size_t const clsID = _classID(bytes, alignment);
+        if (_m_freeLists[clsID] == nullptr) { _refill(clsID); }
+
+        _FreeNode *const node = _m_freeLists[clsID];
+        _m_freeLists[clsID]   = node->next;
+        return node;
+    }
+
+    void
+    do_deallocate(void *ptr, size_t bytes, size_t alignment) override {
+        if (_is_large(bytes, alignment)) { return _deallocate_large(ptr, bytes, alignment); }
+
+        size_t const clsID  = _classID(bytes, alignment);
+        _FreeNode   *node   = ::new (ptr) _FreeNode{_m_freeLists[clsID]};
+        _m_freeLists[clsID] = node;
+    }
+
+    bool
+    do_is_equal(std::pmr::memory_resource const &other) const noexcept override {
+        return this == &other;
+    }
+
+private:
+    [[nodiscard]] static constexpr bool
+    _is_large(size_t bytes, size_t alignment) noexcept {
+        return bytes > c_maxClassSz || alignment > c_maxAlignment;
+    }
+
+    [[nodiscard]] static constexpr size_t
+    _classID(size_t bytes, size_t alignment) noexcept {
+        size_t const clsSz = std::bit_ceil(std::max({bytes, alignment, c_minClassSz}));
+        return std::countr_zero(clsSz) - std::countr_zero(c_minClassSz);
+    }
+
+    void
+    _refill(size_t clsID) {
+        size_t const clsSz  = c_minClassSz << clsID;
+        size_t const count  = std::max(c_batchBytes / clsSz, 4uz);
+        auto *const  blocks = static_cast<std::byte *>(_m_arena.allocate(clsSz * count, c_maxAlignment));
+
+        for (size_t i = count; i-- > 0;) {
+            _m_freeLists[clsID] = ::new (blocks + i * clsSz) _FreeNode{_m_freeLists[clsID]};
+        }
+    }
+
+    // Large allocations have a header placed right in front of the returned pointer
+    [[nodiscard]] static constexpr size_t
+    _large_padding(size_t alignment) noexcept {
+        return detail::_align_up(sizeof(_LargeHeader), std::max(alignment, alignof(_LargeHeader)));
+    }
+
+    void *
+    _allocate_large(size_t bytes, size_t alignment) {
+        size_t const pad  = _large_padding(alignment);
+        auto *const  base = static_cast<std::byte *>(
+            _m_arena.upstream_resource()->allocate(bytes + pad, std::max(alignment, alignof(_LargeHeader))));
+        auto *const hdr =
+            ::new (base + pad - sizeof(_LargeHeader)) _LargeHeader{nullptr, _m_large, bytes, alignment};
+        if (_m_large != nullptr) { _m_large->prev = hdr; }
+        _m_large = hdr;
+        return base + pad;
+    }
+
+    void
+    _deallocate_large(void *ptr, size_t, size_t) noexcept {
+        auto *const hdr = reinterpret_cast<_LargeHeader *>(static_cast<std::byte *>(ptr) - sizeof(_LargeHeader));
+
+        if (hdr->prev != nullptr) { hdr->prev->next = hdr->next; }
+        else { _m_large = hdr->next; }
+        if (hdr->next != nullptr) { hdr->next->prev = hdr->prev; }
+
+        _free_large(hdr);
+    }
+
+    void
+    _free_large(_LargeHeader *hdr) noexcept {
+        size_t const pad  = _large_padding(hdr->alignment);
+        auto *const  base = reinterpret_cast<std::byte *>(hdr) + sizeof(_LargeHeader) - pad;
+        _m_arena.upstream_resource()->deallocate(base, hdr->bytes + pad,
+                                                 std::max(hdr->alignment, alignof(_LargeHeader)));
+    }
+
+    void
+    _release_large() noexcept {
+        while (_m_large != nullptr) { _free_large(std::exchange(_m_large, _m_large->next)); }
+    }
+};
+
+} // namespace incom::standard::allocators
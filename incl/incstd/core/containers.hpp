@@ -1,7 +1,24 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
 #include <ranges>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 
@@ -10,79 +27,124 @@ namespace detail {
 
 using namespace incom::standard;
 
-template <typename T>
-struct _RingVector_sentinel {};
-
-template <typename T>
+// Random access iterator over the logical (head-first) order of a RingVector
+// The underlying buffer is addressed by 'offset from head', so increments are plain integer arithmetic and the wrap
+// around is resolved only on dereference (compiles to a conditional move instead of a branch per step)
+// With compile time (power of 2) 'Extent' the wrap around is a simple mask
+template <typename T, bool IsConst, size_t Extent = std::dynamic_extent>
 class _RingVector_iter {
-    using base_iterator  = std::ranges::iterator_t<std::vector<T>>;
-    using base_sentinel  = std::ranges::sentinel_t<std::vector<T>>;
-    using base_reference = std::ranges::range_reference_t<std::vector<T>>;
+    using data_ptr_t = std::conditional_t<IsConst, T const *, T *>;
 
-    base_iterator _iter;
-    base_iterator _sentinel;
-    base_iterator _iter_underlying_beg;
-    base_sentinel _sentinel_underlying;
-    bool          circled = false;
+    data_ptr_t     _m_data = nullptr;
+    size_t         _m_sz   = 0;
+    size_t         _m_head = 0;
+    std::ptrdiff_t _m_off  = 0;
+
+    friend class _RingVector_iter<T, not IsConst, Extent>;
 
 public:
-    using difference_type = std::ptrdiff_t;
-    using value_type      = T;
-    using reference       = base_reference;
+    using difference_type  = std::ptrdiff_t;
+    using value_type       = T;
+    using reference        = std::conditional_t<IsConst, T const &, T &>;
+    using pointer          = data_ptr_t;
+    using iterator_concept = std::random_access_iterator_tag;
 
-    using iterator_category = std::forward_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
 
-    _RingVector_iter() = default;
+    constexpr _RingVector_iter() = default;
 
-    _RingVector_iter(base_iterator begin, base_iterator begin_underlying, base_sentinel end_underlying)
-        : _iter(begin), _sentinel(begin), _iter_underlying_beg(begin_underlying), _sentinel_underlying(end_underlying) {
-    }
+    constexpr _RingVector_iter(data_ptr_t data, size_t sz, size_t head, std::ptrdiff_t off)
+        : _m_data(data), _m_sz(sz), _m_head(head), _m_off(off) {}
 
-    T &
-    operator*() const {
-        return *_iter;
-    };
-    T &
-    operator*() {
-        return *_iter;
-    };
+    // Conversion from non-const to const iterator
+    template <bool OtherConst>
+    requires(IsConst && not OtherConst)
+    constexpr _RingVector_iter(_RingVector_iter<T, OtherConst, Extent> const &other)
+        : _m_data(other._m_data), _m_sz(other._m_sz), _m_head(other._m_head), _m_off(other._m_off) {}
 
+    [[nodiscard]] constexpr reference
+    operator*() const {
+        return _m_data[_wrapped(_m_off)];
+    }
+    [[nodiscard]] constexpr reference
+    operator[](difference_type n) const {
+        return _m_data[_wrapped(_m_off + n)];
+    }
 
-    _RingVector_iter &
+    constexpr _RingVector_iter &
     operator++() {
-        if (++_iter == _sentinel_underlying) {
-            _iter   = _iter_underlying_beg;
-            circled = true;
-        }
+        ++_m_off;
         return *this;
     }
-    _RingVector_iter
-    operator++(int) // post-incrementable, returns prev value
-    {
+    constexpr _RingVector_iter
+    operator++(int) {
         _RingVector_iter temp = *this;
-        ++(*this);
+        ++_m_off;
+        return temp;
+    }
+    constexpr _RingVector_iter &
+    operator--() {
+        --_m_off;
+        return *this;
+    }
+    constexpr _RingVector_iter
+    operator--(int) {
+        _RingVector_iter temp = *this;
+        --_m_off;
         return temp;
     }
 
-    auto
-    operator==(const _RingVector_iter &other) const {
-        return other._iter == _iter && other._sentinel == _sentinel &&
-               other._iter_underlying_beg == _iter_underlying_beg && other._sentinel_underlying == _sentinel_underlying;
+    constexpr _RingVector_iter &
+    operator+=(difference_type n) {
+        _m_off += n;
+        return *this;
+    }
+    constexpr _RingVector_iter &
+    operator-=(difference_type n) {
+        _m_off -= n;
+        return *this;
     }
 
-    auto
-    operator<=>(const _RingVector_iter<T> &other) const = default;
+    [[nodiscard]] friend constexpr _RingVector_iter
+    operator+(_RingVector_iter it, difference_type n) {
+        return it += n;
+    }
+    [[nodiscard]] friend constexpr _RingVector_iter
+    operator+(difference_type n, _RingVector_iter it) {
+        return it += n;
+    }
+    [[nodiscard]] friend constexpr _RingVector_iter
+    operator-(_RingVector_iter it, difference_type n) {
+        return it -= n;
+    }
+    [[nodiscard]] friend constexpr difference_type
+    operator-(_RingVector_iter const &lhs, _RingVector_iter const &rhs) {
+        return lhs._m_off - rhs._m_off;
+    }
 
-    auto
-    operator==(const _RingVector_sentinel<T> &) const -> bool {
-        return (circled == true && _iter == _sentinel);
+    [[nodiscard]] constexpr bool
+    operator==(const _RingVector_iter &other) const {
+        return _m_off == other._m_off;
+    }
+    [[nodiscard]] constexpr auto
+    operator<=>(const _RingVector_iter &other) const {
+        return _m_off <=> other._m_off;
+    }
+
+private:
+    [[nodiscard]] constexpr size_t
+    _wrapped(std::ptrdiff_t off) const {
+        size_t const idx = _m_head + static_cast<size_t>(off);
+        if constexpr (Extent != std::dynamic_extent) { return idx & (Extent - 1); }
+        else { return idx >= _m_sz ? idx - _m_sz : idx; }
     }
 };
 
 } // namespace detail
 
 // Ring vector for future usage in 'scrolling plot' scenarios
-template <typename T>
+// Default (dynamic extent) version owns a heap allocated std::vector, see the specialization below for fixed capacity
+template <typename T, size_t N = std::dynamic_extent>
 class RingVector {
 private:
     std::vector<T> _m_buf;
@@ -130,49 +192,211 @@ public:
     RingVector(std::vector<T> const &t) : _m_buf(t), _m_tail(std::max(0uz, _m_buf.size() - 1)) {};
 
 
-    [[nodiscard]] constexpr detail::_RingVector_iter<T>
+    using iterator       = detail::_RingVector_iter<T, false>;
+    using const_iterator = detail::_RingVector_iter<T, true>;
+
+    [[nodiscard]] constexpr iterator
     begin() {
-        return detail::_RingVector_iter<T>(_m_buf.begin() + _m_head, _m_buf.begin(), _m_buf.end());
+        return iterator(_m_buf.data(), _m_buf.size(), _m_head, 0);
     };
-    [[nodiscard]] constexpr detail::_RingVector_sentinel<T>
+    [[nodiscard]] constexpr iterator
     end() {
-        return detail::_RingVector_sentinel<T>{};
+        return iterator(_m_buf.data(), _m_buf.size(), _m_head, static_cast<std::ptrdiff_t>(_m_buf.size()));
     };
-    [[nodiscard]] constexpr auto
-    cbegin() {
-        return detail::_RingVector_iter<T>(_m_buf.begin() + _m_head, _m_buf.begin(), _m_buf.end());
+    [[nodiscard]] constexpr const_iterator
+    begin() const {
+        return const_iterator(_m_buf.data(), _m_buf.size(), _m_head, 0);
     };
-    [[nodiscard]] constexpr auto
-    cend() {
-        return detail::_RingVector_sentinel<T>{};
+    [[nodiscard]] constexpr const_iterator
+    end() const {
+        return const_iterator(_m_buf.data(), _m_buf.size(), _m_head, static_cast<std::ptrdiff_t>(_m_buf.size()));
+    };
+    [[nodiscard]] constexpr const_iterator
+    cbegin() const {
+        return begin();
+    };
+    [[nodiscard]] constexpr const_iterator
+    cend() const {
+        return end();
     };
 
-    [[nodiscard]] constexpr const auto
+    [[nodiscard]] constexpr T &
+    operator[](size_t id) {
+        return *(begin() + static_cast<std::ptrdiff_t>(id));
+    }
+    [[nodiscard]] constexpr T const &
+    operator[](size_t id) const {
+        return *(begin() + static_cast<std::ptrdiff_t>(id));
+    }
+
+    [[nodiscard]] constexpr size_t
+    size() const {
+        return _m_buf.size();
+    }
+
+    // The ring in logical order as (at most) two contiguous segments: [head, end) followed by [0, head)
+    // Use this for memcpy, SIMD reductions and the like ... no per element wrap around handling necessary
+    [[nodiscard]] constexpr std::pair<std::span<T>, std::span<T>>
+    as_spans() {
+        std::span<T> whole(_m_buf);
+        return {whole.subspan(_m_head), whole.first(_m_head)};
+    }
+    [[nodiscard]] constexpr std::pair<std::span<T const>, std::span<T const>>
+    as_spans() const {
+        std::span<T const> whole(_m_buf);
+        return {whole.subspan(_m_head), whole.first(_m_head)};
+    }
+
+    constexpr std::vector<T>
+    create_copy() const {
+        auto const [fst, snd] = as_spans();
+
+        std::vector<T> res;
+        res.reserve(_m_buf.size());
+        res.insert(res.end(), fst.begin(), fst.end());
+        res.insert(res.end(), snd.begin(), snd.end());
+        return res;
+    }
+
+    constexpr std::vector<T>
+    create_copy_reversed() const {
+        auto const [fst, snd] = as_spans();
+
+        std::vector<T> res;
+        res.reserve(_m_buf.size());
+        res.insert(res.end(), snd.rbegin(), snd.rend());
+        res.insert(res.end(), fst.rbegin(), fst.rend());
+        return res;
+    }
+};
+
+// Fixed capacity, allocation free version backed by std::array
+// N must be a power of 2 so that wrap around is a mask instead of a compare and branch
+// Usable in constexpr contexts
+template <typename T, size_t N>
+requires(N != std::dynamic_extent)
+class RingVector<T, N> {
+    static_assert(std::has_single_bit(N), "RingVector<T, N> requires N to be a power of 2");
+
+    static constexpr size_t c_mask = N - 1;
+
+private:
+    std::array<T, N> _m_buf{};
+    size_t           _m_head = 0;
+    size_t           _m_tail = N - 1;
+
+public:
+    constexpr RingVector() = default;
+    constexpr RingVector(std::array<T, N> &&t) : _m_buf(std::move(t)) {};
+    constexpr RingVector(std::array<T, N> const &t) : _m_buf(t) {};
+
+    constexpr void
+    changeTailTo(T const &item) {
+        _m_buf[_m_tail] = item;
+    }
+    constexpr void
+    changeTailTo(T &&item) {
+        _m_buf[_m_tail] = std::move(item);
+    }
+
+    constexpr void
+    update_preRotate(T const &item) {
+        changeTailTo(item);
+        rotate_byOne();
+    }
+    constexpr void
+    update_preRotate(T &&item) {
+        changeTailTo(std::forward<decltype(item)>(item));
+        rotate_byOne();
+    }
+    constexpr void
+    update_postRotate(T const &item) {
+        rotate_byOne();
+        changeTailTo(item);
+    }
+    constexpr void
+    update_postRotate(T &&item) {
+        rotate_byOne();
+        changeTailTo(std::forward<decltype(item)>(item));
+    }
+
+    constexpr void
+    rotate_byOne() {
+        _m_tail = _m_head;
+        _m_head = (_m_head + 1) & c_mask;
+    }
+
+
+    using iterator       = detail::_RingVector_iter<T, false, N>;
+    using const_iterator = detail::_RingVector_iter<T, true, N>;
+
+    [[nodiscard]] constexpr iterator
+    begin() {
+        return iterator(_m_buf.data(), N, _m_head, 0);
+    };
+    [[nodiscard]] constexpr iterator
+    end() {
+        return iterator(_m_buf.data(), N, _m_head, static_cast<std::ptrdiff_t>(N));
+    };
+    [[nodiscard]] constexpr const_iterator
     begin() const {
-        return detail::_RingVector_iter<T>(_m_buf.begin() + _m_head, _m_buf.begin(), _m_buf.end());
+        return const_iterator(_m_buf.data(), N, _m_head, 0);
     };
-    [[nodiscard]] constexpr const auto
+    [[nodiscard]] constexpr const_iterator
     end() const {
-        return detail::_RingVector_sentinel<T>{};
+        return const_iterator(_m_buf.data(), N, _m_head, static_cast<std::ptrdiff_t>(N));
+    };
+    [[nodiscard]] constexpr const_iterator
+    cbegin() const {
+        return begin();
+    };
+    [[nodiscard]] constexpr const_iterator
+    cend() const {
+        return end();
     };
 
-    size_t
+    [[nodiscard]] constexpr T &
+    operator[](size_t id) {
+        return _m_buf[(_m_head + id) & c_mask];
+    }
+    [[nodiscard]] constexpr T const &
+    operator[](size_t id) const {
+        return _m_buf[(_m_head + id) & c_mask];
+    }
+
+    [[nodiscard]] static constexpr size_t
     size() {
-        return _m_buf.size();
+        return N;
     }
 
-    // TODO: Might not need to create a copy here or below once std::views::concatenate from C++26 exists
-    constexpr std::vector<T>
+    // The ring in logical order as (at most) two contiguous segments: [head, end) followed by [0, head)
+    [[nodiscard]] constexpr std::pair<std::span<T>, std::span<T>>
+    as_spans() {
+        std::span<T> whole(_m_buf);
+        return {whole.subspan(_m_head), whole.first(_m_head)};
+    }
+    [[nodiscard]] constexpr std::pair<std::span<T const>, std::span<T const>>
+    as_spans() const {
+        std::span<T const> whole(_m_buf);
+        return {whole.subspan(_m_head), whole.first(_m_head)};
+    }
+
+    // Returns std::array (instead of std::vector) in order to stay allocation free
+    constexpr std::array<T, N>
     create_copy() const {
-        std::vector<T> res(_m_buf.begin() + _m_head, _m_buf.end());
-        for (int i = 0; i < _m_head; ++i) { res.push_back(_m_buf[i]); }
+        auto const [fst, snd] = as_spans();
+
+        std::array<T, N> res;
+        std::ranges::copy(snd, std::ranges::copy(fst, res.begin()).out);
         return res;
     }
 
-    constexpr std::vector<T>
+    constexpr std::array<T, N>
     create_copy_reversed() const {
-        std::vector<T> res(_m_buf.rbegin() + (_m_buf.size() - _m_head), _m_buf.rend());
-        for (int i = (_m_buf.size() - 1); i >= _m_head; --i) { res.push_back(_m_buf[i]); }
+        auto const [fst, snd] = as_spans();
+
+        std::array<T, N> res;
+        std::ranges::copy(fst | std::views::reverse, std::ranges::copy(snd | std::views::reverse, res.begin()).out);
         return res;
     }
 };
@@ -181,6 +405,722 @@ template <typename T>
 RingVector(std::vector<T> &&t) -> RingVector<T>;
 template <typename T>
 RingVector(std::vector<T> const &t) -> RingVector<T>;
+template <typename T, size_t N>
+RingVector(std::array<T, N> &&t) -> RingVector<T, N>;
+template <typename T, size_t N>
+RingVector(std::array<T, N> const &t) -> RingVector<T, N>;
+
+
+// Bounded multi producer single consumer queue (Dmitry Vyukov's sequence number ring)
+// Producers only contend on one CAS of the enqueue position, the consumer does not contend at all
+// Capacity is rounded up to a power of 2
+template <typename T>
+class MPSCQueue {
+    static constexpr size_t c_cacheLineSz = 64uz;
+
+    struct Cell {
+        std::atomic<size_t> seq;
+        alignas(T) std::byte storage[sizeof(T)];
+
+        T *
+        item() {
+            return std::launder(reinterpret_cast<T *>(storage));
+        }
+    };
+
+private:
+    size_t                  _m_mask;
+    std::unique_ptr<Cell[]> _m_cells;
+
+    alignas(c_cacheLineSz) std::atomic<size_t> _m_enqPos = 0;
+    alignas(c_cacheLineSz) size_t _m_deqPos = 0;
+
+public:
+    explicit MPSCQueue(size_t capacity)
+        : _m_mask(std::bit_ceil(std::max(capacity, 2uz)) - 1), _m_cells(std::make_unique<Cell[]>(_m_mask + 1)) {
+        for (size_t i = 0; i <= _m_mask; ++i) { _m_cells[i].seq.store(i, std::memory_order_relaxed); }
+    }
+
+    //    NOT copiable or movable, producers and the consumer hold references to it
+    MPSCQueue(MPSCQueue const &) = delete;
+    MPSCQueue(MPSCQueue &&)      = delete;
+    MPSCQueue &
+    operator=(MPSCQueue const &) = delete;
+    MPSCQueue &
+    operator=(MPSCQueue &&) = delete;
+
+    ~MPSCQueue() {
+        while (try_pop().has_value()) {}
+    }
+
+    [[nodiscard]] size_t
+    capacity() const {
+        return _m_mask + 1;
+    }
+
+    // PRODUCER SIDE (any number of threads)
+    // Returns false if the queue is full (item is not consumed in that case)
+    template <typename... Args>
+    [[nodiscard]] bool
+    try_emplace(Args &&...args) {
+        size_t pos = _m_enqPos.load(std::memory_order_relaxed);
+        Cell  *cell;
+        while (true) {
+            cell                    = &_m_cells[pos & _m_mask];
+            size_t const         sq = cell->seq.load(std::memory_order_acquire);
+            std::ptrdiff_t const df = static_cast<std::ptrdiff_t>(sq) - static_cast<std::ptrdiff_t>(pos);
+
+            if (df == 0) {
+                if (_m_enqPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) { break; }
+            }
+            else if (df < 0) { return false; }
+            else { pos = _m_enqPos.load(std::memory_order_relaxed); }
+        }
+        std::construct_at(reinterpret_cast<T *>(cell->storage), std::forward<Args>(args)...);
+        cell->seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    [[nodiscard]] bool
+    try_push(T const &item) {
+        return try_emplace(item);
+    }
+    [[nodiscard]] bool
+    try_push(T &&item) {
+        return try_emplace(std::move(item));
+    }
+
+    // Blocks (spinning, then yielding) until there is space in the queue
+    void
+    push_wait(T const &item) {
+        for (size_t spins = 0; not try_emplace(item); ++spins) { _backoff(spins); }
+    }
+    void
+    push_wait(T &&item) {
+        for (size_t spins = 0; not try_emplace(std::move(item)); ++spins) { _backoff(spins); }
+    }
+
+    // CONSUMER SIDE (exactly one thread)
+    [[nodiscard]] std::optional<T>
+    try_pop() {
+        Cell &cell = _m_cells[_m_deqPos & _m_mask];
+        if (cell.seq.load(std::memory_order_acquire) != _m_deqPos + 1) { return std::nullopt; }
+
+        std::optional<T> res(std::move(*cell.item()));
+        std::destroy_at(cell.item());
+        cell.seq.store(_m_deqPos + _m_mask + 1, std::memory_order_release);
+        ++_m_deqPos;
+        return res;
+    }
+
+    // Pops up to 'maxCount' items passing each (as rvalue) to 'func', returns how many were drained
+    template <typename F>
+    requires std::invocable<F, T &&>
+    size_t
+    drain(F &&func, size_t maxCount = std::numeric_limits<size_t>::max()) {
+        size_t count = 0;
+        for (; count < maxCount; ++count) {
+            Cell &cell = _m_cells[_m_deqPos & _m_mask];
+            if (cell.seq.load(std::memory_order_acquire) != _m_deqPos + 1) { break; }
+
+            func(std::move(*cell.item()));
+            std::destroy_at(cell.item());
+            cell.seq.store(_m_deqPos + _m_mask + 1, std::memory_order_release);
+            ++_m_deqPos;
+        }
+        return count;
+    }
+
+    // Batch drain into a RingVector ... newest item ends up last in the RingVector's logical order
+    template <size_t N>
+    size_t
+    drain_into(RingVector<T, N> &ringVec, size_t maxCount = std::numeric_limits<size_t>::max()) {
+        return drain([&](T &&item) { ringVec.update_postRotate(std::move(item)); }, maxCount);
+    }
+
+private:
+    static void
+    _backoff(size_t spins) {
+        if (spins > 64uz) { std::this_thread::yield(); }
+    }
+};
+
+// Vector with inline storage for up to N elements, spills to the heap only when it grows beyond that
+// Provides the commonly used subset of std::vector interface
+template <typename T, size_t N>
+requires(N > 0)
+class SmallVector {
+public:
+    using value_type             = T;
+    using size_type              = size_t;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = T &;
+    using const_reference        = T const &;
+    using pointer                = T *;
+    using const_pointer          = T const *;
+    using iterator               = T *;
+    using const_iterator         = T const *;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+    T     *_m_data = _inline();
+    size_t _m_sz   = 0;
+    size_t _m_cap  = N;
+
+    alignas(T) std::byte _m_inline[N * sizeof(T)];
+
+public:
+    SmallVector() noexcept {}
+    explicit SmallVector(size_t count) { resize(count); }
+    SmallVector(size_t count, T const &value) { resize(count, value); }
+    SmallVector(std::initializer_list<T> init) : SmallVector(init.begin(), init.end()) {}
+
+    template <std::input_iterator It, std::sentinel_for<It> Sent>
+    SmallVector(It first, Sent last) {
+        if constexpr (std::sized_sentinel_for<Sent, It>) { reserve(static_cast<size_t>(last - first)); }
+        for (; first != last; ++first) { emplace_back(*first); }
+    }
+
+    SmallVector(SmallVector const &other) {
+        reserve(other._m_sz);
+        std::uninitialized_copy_n(other._m_data, other._m_sz, _m_data);
+        _m_sz = other._m_sz;
+    }
+    SmallVector(SmallVector &&other) noexcept(std::is_nothrow_move_constructible_v<T>) { _steal(other); }
+
+    SmallVector &
+    operator=(SmallVector const &other) {
+        if (this != &other) {
+            clear();
+            reserve(other._m_sz);
+            std::uninitialized_copy_n(other._m_data, other._m_sz, _m_data);
+            _m_sz = other._m_sz;
+        }
+        return *this;
+    }
+    SmallVector &
+    operator=(SmallVector &&other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            _release();
+            _steal(other);
+        }
+        return *this;
+    }
+
+    ~SmallVector() { _release(); }
+
+
+    // ACCESS
+    [[nodiscard]] T &
+    operator[](size_t id) {
+        return _m_data[id];
+    }
+    [[nodiscard]] T const &
+    operator[](size_t id) const {
+        return _m_data[id];
+    }
+    [[nodiscard]] T &
+    at(size_t id) {
+        if (id >= _m_sz) { throw std::out_of_range("SmallVector::at"); }
+        return _m_data[id];
+    }
+    [[nodiscard]] T const &
+    at(size_t id) const {
+        if (id >= _m_sz) { throw std::out_of_range("SmallVector::at"); }
+        return _m_data[id];
+    }
+    [[nodiscard]] T &
+    front() {
+        return _m_data[0];
+    }
+    [[nodiscard]] T const &
+    front() const {
+        return _m_data[0];
+    }
+    [[nodiscard]] T &
+    back() {
+        return _m_data[_m_sz - 1];
+    }
+    [[nodiscard]] T const &
+    back() const {
+        return _m_data[_m_sz - 1];
+    }
+    [[nodiscard]] T *
+    data() noexcept {
+        return _m_data;
+    }
+    [[nodiscard]] T const *
+    data() const noexcept {
+        return _m_data;
+    }
+
+    [[nodiscard]] iterator
+    begin() noexcept {
+        return _m_data;
+    }
+    [[nodiscard]] iterator
+    end() noexcept {
+        return _m_data + _m_sz;
+    }
+    [[nodiscard]] const_iterator
+    begin() const noexcept {
+        return _m_data;
+    }
+    [[nodiscard]] const_iterator
+    end() const noexcept {
+        return _m_data + _m_sz;
+    }
+    [[nodiscard]] const_iterator
+    cbegin() const noexcept {
+        return _m_data;
+    }
+    [[nodiscard]] const_iterator
+    cend() const noexcept {
+        return _m_data + _m_sz;
+    }
+    [[nodiscard]] reverse_iterator
+    rbegin() noexcept {
+        return reverse_iterator(end());
+    }
+    [[nodiscard]] reverse_iterator
+    rend() noexcept {
+        return reverse_iterator(begin());
+    }
+    [[nodiscard]] const_reverse_iterator
+    rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    [[nodiscard]] const_reverse_iterator
+    rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    // CAPACITY
+    [[nodiscard]] size_t
+    size() const noexcept {
+        return _m_sz;
+    }
+    [[nodiscard]] bool
+    empty() const noexcept {
+        return _m_sz == 0;
+    }
+    [[nodiscard]] size_t
+    capacity() const noexcept {
+        return _m_cap;
+    }
+    [[nodiscard]] static constexpr size_t
+    inline_capacity() noexcept {
+        return N;
+    }
+    [[nodiscard]] bool
+    is_inline() const noexcept {
+        return _m_data == _inline();
+    }
+
+    void
+    reserve(size_t newCap) {
+        if (newCap > _m_cap) { _reallocate(newCap); }
+    }
+
+    // MODIFIERS
+    template <typename... Args>
+    T &
+    emplace_back(Args &&...args) {
+        if (_m_sz == _m_cap) {
+            // Construct the new element first ... 'args' may reference our own elements
+            size_t const newCap = _grown_cap(_m_sz + 1);
+            T *const     newBuf = std::allocator<T>{}.allocate(newCap);
+            try {
+                std::construct_at(newBuf + _m_sz, std::forward<Args>(args)...);
+            }
+            catch (...) {
+                std::allocator<T>{}.deallocate(newBuf, newCap);
+                throw;
+            }
+            try {
+                _relocate_into(newBuf);
+            }
+            catch (...) {
+                std::destroy_at(newBuf + _m_sz);
+                std::allocator<T>{}.deallocate(newBuf, newCap);
+                throw;
+            }
+            _adopt(newBuf, newCap);
+        }
+        else { std::construct_at(_m_data + _m_sz, std::forward<Args>(args)...); }
+        return _m_data[_m_sz++];
+    }
+    void
+    push_back(T const &item) {
+        emplace_back(item);
+    }
+    void
+    push_back(T &&item) {
+        emplace_back(std::move(item));
+    }
+    void
+    pop_back() {
+        std::destroy_at(_m_data + (--_m_sz));
+    }
+
+    iterator
+    erase(const_iterator pos) {
+        return erase(pos, pos + 1);
+    }
+    iterator
+    erase(const_iterator first, const_iterator last) {
+        T *const f = _m_data + (first - _m_data);
+        T *const l = _m_data + (last - _m_data);
+        if (f != l) {
+            T *const newEnd = std::move(l, end(), f);
+            std::destroy(newEnd, end());
+            _m_sz = static_cast<size_t>(newEnd - _m_data);
+        }
+        return f;
+    }
 
+    void
+    resize(size_t count) {
+        if (count < _m_sz) { erase(begin() + count, end()); }
+        else {
+            reserve(count);
+            std::uninitialized_value_construct_n(_m_data + _m_sz, count - _m_sz);
+            _m_sz = count;
+        }
+    }
+    void
+    resize(size_t count, T const &value) {
+        if (count < _m_sz) { erase(begin() + count, end()); }
+        else {
+            reserve(count);
+            std::uninitialized_fill_n(_m_data + _m_sz, count - _m_sz, value);
+            _m_sz = count;
+        }
+    }
+
+    void
+    clear() noexcept {
+        std::destroy_n(_m_data, _m_sz);
+        _m_sz = 0;
+    }
+
+    // COMPARISON
+    [[nodiscard]] friend bool
+    operator==(SmallVector const &lhs, SmallVector const &rhs) {
+        return std::ranges::equal(lhs, rhs);
+    }
+    [[nodiscard]] friend auto
+    operator<=>(SmallVector const &lhs, SmallVector const &rhs)
+    requires std::three_way_comparable<T>
+    {
+        return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+private:
+    T *
+    _inline() noexcept {
+        return reinterpret_cast<T *>(_m_inline);
+    }
+    T const *
+    _inline() const noexcept {
+        return reinterpret_cast<T const *>(_m_inline);
+    }
+
+    size_t
+    _grown_cap(size_t required) const {
+        return std::max(required, _m_cap * 2);
+    }
+
+    void
+    _reallocate(size_t newCap) {
+        T *const newBuf = std::allocator<T>{}.allocate(newCap);
+        try {
+            _relocate_into(newBuf);
+        }
+        catch (...) {
+            std::allocator<T>{}.deallocate(newBuf, newCap);
+            throw;
+        }
+        _adopt(newBuf, newCap);
+    }
+
+    // Same as 'std::move_if_noexcept', copies when moving could throw (and copying is possible) so that the old
+    // elements stay intact if it fails. On failure nothing is left constructed in 'newBuf'
+    void
+    _relocate_into(T *newBuf) {
+        if constexpr (std::is_nothrow_move_constructible_v<T> || not std::is_copy_constructible_v<T>) {
+            std::uninitialized_move_n(_m_data, _m_sz, newBuf);
+        }
+        else { std::uninitialized_copy_n(_m_data, _m_sz, newBuf); }
+    }
+
+    // Takes ownership of 'newBuf' which already holds the moved-to elements
+    void
+    _adopt(T *newBuf, size_t newCap) {
+        std::destroy_n(_m_data, _m_sz);
+        if (not is_inline()) { std::allocator<T>{}.deallocate(_m_data, _m_cap); }
+        _m_data = newBuf;
+        _m_cap  = newCap;
+    }
+
+    void
+    _release() noexcept {
+        clear();
+        if (not is_inline()) { std::allocator<T>{}.deallocate(_m_data, _m_cap); }
+        _m_data = _inline();
+        _m_cap  = N;
+    }
+
+    // Expects 'this' to be empty and inline
+    void
+    _steal(SmallVector &other) {
+        if (other.is_inline()) {
+            std::uninitialized_move_n(other._m_data, other._m_sz, _m_data);
+            _m_sz = other._m_sz;
+            other.clear();
+        }
+        else {
+            _m_data = std::exchange(other._m_data, other._inline());
+            _m_sz   = std::exchange(other._m_sz, 0uz);
+            _m_cap  = std::exchange(other._m_cap, N);
+        }
+    }
+};
+
+
+// Flat map that keeps its (at most) N entries inline and finds them by a linear scan over cached hashes
+// Beyond N entries the entries spill to the heap and a linear probing (open addressing) index is built over them
+// Iteration is in insertion order (until erase, which moves the last entry into the erased spot)
+// Note: Keys must not be modified through the iterators
+template <typename K, typename V, size_t N, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+requires(N > 0)
+class SmallFlatMap {
+public:
+    using key_type       = K;
+    using mapped_type    = V;
+    using value_type     = std::pair<K, V>;
+    using size_type      = size_t;
+    using iterator       = SmallVector<value_type, N>::iterator;
+    using const_iterator = SmallVector<value_type, N>::const_iterator;
+
+private:
+    static constexpr size_t c_npos = std::numeric_limits<size_t>::max();
+
+    SmallVector<value_type, N> _m_entries;
+    SmallVector<size_t, N>     _m_hashes;
+    std::vector<size_t>        _m_index; // Entry ID + 1 (0 means empty slot), empty when not spilled
+
+    [[no_unique_address]] Hash     _m_hasher{};
+    [[no_unique_address]] KeyEqual _m_keyEq{};
+
+public:
+    SmallFlatMap() = default;
+    SmallFlatMap(std::initializer_list<value_type> init) {
+        for (auto const &item : init) { insert(item); }
+    }
+
+    // LOOKUP
+    [[nodiscard]] iterator
+    find(K const &key) {
+        size_t const id = _find_id(key, _m_hasher(key));
+        return id == c_npos ? end() : begin() + id;
+    }
+    [[nodiscard]] const_iterator
+    find(K const &key) const {
+        size_t const id = _find_id(key, _m_hasher(key));
+        return id == c_npos ? end() : begin() + id;
+    }
+    [[nodiscard]] bool
+    contains(K const &key) const {
+        return _find_id(key, _m_hasher(key)) != c_npos;
+    }
+    [[nodiscard]] size_t
+    count(K const &key) const {
+        return contains(key) ? 1 : 0;
+    }
+    [[nodiscard]] V &
+    at(K const &key) {
+        size_t const id = _find_id(key, _m_hasher(key));
+        if (id == c_npos) { throw std::out_of_range("SmallFlatMap::at"); }
+        return _m_entries[id].second;
+    }
+    [[nodiscard]] V const &
+    at(K const &key) const {
+        size_t const id = _find_id(key, _m_hasher(key));
+        if (id == c_npos) { throw std::out_of_range("SmallFlatMap::at"); }
+        return _m_entries[id].second;
+    }
+    V &
+    operator[](K const &key) {
+        return try_emplace(key).first->second;
+    }
+    V &
+    operator[](K &&key) {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    // MODIFIERS
+    template <typename... Args>
+    std::pair<iterator, bool>
+    try_emplace(K const &key, Args &&...args) {
+        return _try_emplace_impl(key, std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    std::pair<iterator, bool>
+    try_emplace(K &&key, Args &&...args) {
+        return _try_emplace_impl(std::move(key), std::forward<Args>(args)...);
+    }
+    template <typename KK, typename VV>
+    std::pair<iterator, bool>
+    emplace(KK &&key, VV &&value) {
+        return try_emplace(std::forward<KK>(key), std::forward<VV>(value));
+    }
+    std::pair<iterator, bool>
+    insert(value_type const &item) {
+        return try_emplace(item.first, item.second);
+    }
+    std::pair<iterator, bool>
+    insert(value_type &&item) {
+        return try_emplace(std::move(item.first), std::move(item.second));
+    }
+
+    size_t
+    erase(K const &key) {
+        size_t const hsh = _m_hasher(key);
+        size_t const id  = _find_id(key, hsh);
+        if (id == c_npos) { return 0; }
+
+        size_t const lastID = _m_entries.size() - 1;
+        if (not _m_index.empty()) {
+            _index_erase(_index_slotOf(id, hsh));
+            if (id != lastID) { _m_index[_index_slotOf(lastID, _m_hashes[lastID])] = id + 1; }
+        }
+        if (id != lastID) {
+            _m_entries[id] = std::move(_m_entries[lastID]);
+            _m_hashes[id]  = _m_hashes[lastID];
+        }
+        _m_entries.pop_back();
+        _m_hashes.pop_back();
+        return 1;
+    }
+
+    void
+    clear() noexcept {
+        _m_entries.clear();
+        _m_hashes.clear();
+        _m_index.clear();
+    }
+    void
+    reserve(size_t count) {
+        _m_entries.reserve(count);
+        _m_hashes.reserve(count);
+        if (count > N) { _index_rebuild(std::bit_ceil(count * 2)); }
+    }
+
+    // CAPACITY AND ITERATION
+    [[nodiscard]] size_t
+    size() const noexcept {
+        return _m_entries.size();
+    }
+    [[nodiscard]] bool
+    empty() const noexcept {
+        return _m_entries.empty();
+    }
+    [[nodiscard]] bool
+    is_inline() const noexcept {
+        return _m_entries.is_inline();
+    }
+
+    [[nodiscard]] iterator
+    begin() noexcept {
+        return _m_entries.begin();
+    }
+    [[nodiscard]] iterator
+    end() noexcept {
+        return _m_entries.end();
+    }
+    [[nodiscard]] const_iterator
+    begin() const noexcept {
+        return _m_entries.begin();
+    }
+    [[nodiscard]] const_iterator
+    end() const noexcept {
+        return _m_entries.end();
+    }
+
+private:
+    template <typename KK, typename... Args>
+    std::pair<iterator, bool>
+    _try_emplace_impl(KK &&key, Args &&...args) {
+        size_t const hsh = _m_hasher(key);
+        if (size_t const id = _find_id(key, hsh); id != c_npos) { return {begin() + id, false}; }
+
+        _m_entries.emplace_back(std::piecewise_construct, std::forward_as_tuple(std::forward<KK>(key)),
+                                std::forward_as_tuple(std::forward<Args>(args)...));
+        _m_hashes.push_back(hsh);
+
+        size_t const sz = _m_entries.size();
+        if (not _m_index.empty()) {
+            if (sz * 2 > _m_index.size()) { _index_rebuild(_m_index.size() * 2); }
+            else { _index_insert(sz - 1); }
+        }
+        else if (sz > N) { _index_rebuild(std::bit_ceil(sz * 2)); }
+        return {begin() + (sz - 1), true};
+    }
+
+    size_t
+    _find_id(K const &key, size_t hsh) const {
+        if (_m_index.empty()) {
+            for (size_t id = 0; id < _m_hashes.size(); ++id) {
+                if (_m_hashes[id] == hsh && _m_keyEq(_m_entries[id].first, key)) { return id; }
+            }
+            return c_npos;
+        }
+
+        size_t const mask = _m_index.size() - 1;
+        for (size_t slot = hsh & mask;; slot = (slot + 1) & mask) {
+            size_t const idP1 = _m_index[slot];
+            if (idP1 == 0) { return c_npos; }
+            if (_m_hashes[idP1 - 1] == hsh && _m_keyEq(_m_entries[idP1 - 1].first, key)) { return idP1 - 1; }
+        }
+    }
+
+    void
+    _index_rebuild(size_t slotCount) {
+        _m_index.assign(std::max(slotCount, 16uz), 0uz);
+        for (size_t id = 0; id < _m_entries.size(); ++id) { _index_insert(id); }
+    }
+
+    void
+    _index_insert(size_t id) {
+        size_t const mask = _m_index.size() - 1;
+        size_t       slot = _m_hashes[id] & mask;
+        while (_m_index[slot] != 0) { slot = (slot + 1) & mask; }
+        _m_index[slot] = id + 1;
+    }
+
+    size_t
+    _index_slotOf(size_t id, size_t hsh) const {
+        size_t const mask = _m_index.size() - 1;
+        size_t       slot = hsh & mask;
+        while (_m_index[slot] != id + 1) { slot = (slot + 1) & mask; }
+        return slot;
+    }
+
+    // Backward shift deletion ... keeps probe sequences intact without tombstones
+    void
+    _index_erase(size_t slot) {
+        size_t const mask = _m_index.size() - 1;
+        for (size_t next = (slot + 1) & mask; _m_index[next] != 0; next = (next + 1) & mask) {
+            size_t const home = _m_hashes[_m_index[next] - 1] & mask;
+            if (((next - home) & mask) >= ((next - slot) & mask)) {
+                _m_index[slot] = _m_index[next];
+                slot           = next;
+            }
+        }
+        _m_index[slot] = 0;
+    }
+};
 
 } // namespace incom::standard::containers
\ No newline at end of file
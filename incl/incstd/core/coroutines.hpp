@@ -1,9 +1,838 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <execution>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
 
 namespace incom::standard::coroutines {
 namespace detail {
 using namespace incom::standard;
 
+// Coroutine frames are allocated in units of this
+struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) _FrameBlock {
+    std::byte data[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+};
+
+[[nodiscard]] constexpr size_t
+_align_up(size_t value, size_t alignment) noexcept {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Allocation of coroutine frames through an allocator (passed as 'std::allocator_arg, alloc' leading arguments)
+// Layout: [frame][pointer to the deallocating function][copy of the allocator] ... all from one allocation
+// With 'Allocator = void' any allocator can be passed (type erased), without it std::allocator is used
+template <typename Allocator>
+class _promise_allocation {
+    using _dealloc_fn = void (*)(void *, size_t) noexcept;
+
+    template <typename Alloc>
+    using _rebound = typename std::allocator_traits<Alloc>::template rebind_alloc<_FrameBlock>;
+
+    template <typename Alloc>
+    static constexpr size_t
+    _allocOffset(size_t frameSz) noexcept {
+        return _align_up(_align_up(frameSz, alignof(_dealloc_fn)) + sizeof(_dealloc_fn), alignof(_rebound<Alloc>));
+    }
+    template <typename Alloc>
+    static constexpr size_t
+    _blockCount(size_t frameSz) noexcept {
+        return (_allocOffset<Alloc>(frameSz) + sizeof(_rebound<Alloc>) + sizeof(_FrameBlock) - 1) / sizeof(_FrameBlock);
+    }
+
+    template <typename Alloc>
+    static void *
+    _allocate(Alloc const &alloc, size_t frameSz) {
+        _rebound<Alloc> rebound(alloc);
+        auto *const     frame = reinterpret_cast<std::byte *>(rebound.allocate(_blockCount<Alloc>(frameSz)));
+        ::new (frame + _align_up(frameSz, alignof(_dealloc_fn))) _dealloc_fn(&_deallocate<Alloc>);
+        ::new (frame + _allocOffset<Alloc>(frameSz)) _rebound<Alloc>(std::move(rebound));
+        return frame;
+    }
+
+    template <typename Alloc>
+    static void
+    _deallocate(void *ptr, size_t frameSz) noexcept {
+        auto *const frame  = static_cast<std::byte *>(ptr);
+        auto *const stored = std::launder(reinterpret_cast<_rebound<Alloc> *>(frame + _allocOffset<Alloc>(frameSz)));
+
+        _rebound<Alloc> rebound(std::move(*stored));
+        stored->~_rebound<Alloc>();
+        rebound.deallocate(reinterpret_cast<_FrameBlock *>(frame), _blockCount<Alloc>(frameSz));
+    }
+
+    using _default_alloc = std::conditional_t<std::is_void_v<Allocator>, std::allocator<void>, Allocator>;
+
+public:
+    static void *
+    operator new(size_t frameSz)
+    requires std::default_initializable<_default_alloc>
+    {
+        return _allocate(_default_alloc{}, frameSz);
+    }
+
+    template <typename Alloc, typename... Args>
+    requires std::is_void_v<Allocator> || std::convertible_to<Alloc const &, Allocator>
+    static void *
+    operator new(size_t frameSz, std::allocator_arg_t, Alloc const &alloc, Args const &...) {
+        if constexpr (std::is_void_v<Allocator>) { return _allocate(alloc, frameSz); }
+        else { return _allocate(static_cast<Allocator>(alloc), frameSz); }
+    }
+
+    // Member function coroutines (the object comes first)
+    template <typename This, typename Alloc, typename... Args>
+    requires std::is_void_v<Allocator> || std::convertible_to<Alloc const &, Allocator>
+    static void *
+    operator new(size_t frameSz, This const &, std::allocator_arg_t, Alloc const &alloc, Args const &...) {
+        return operator new(frameSz, std::allocator_arg, alloc);
+    }
+
+    static void
+    operator delete(void *ptr, size_t frameSz) noexcept {
+        auto const dealloc = *std::launder(
+            reinterpret_cast<_dealloc_fn *>(static_cast<std::byte *>(ptr) + _align_up(frameSz, alignof(_dealloc_fn))));
+        dealloc(ptr, frameSz);
+    }
+};
+} // namespace detail
+
+
+// Lazy synchronous generator, mirrors the interface of C++23 std::generator<Ref, V, Allocator>
+// Frames can come from any allocator (eg. an arena through std::pmr::polymorphic_allocator) when the coroutine takes
+// 'std::allocator_arg_t, Alloc const &' as its first two parameters
+// Differences from std::generator: no 'elements_of' (recursive yielding), yield the elements one by one instead
+template <typename Ref, typename V = void, typename Allocator = void>
+class generator : public std::ranges::view_interface<generator<Ref, V, Allocator>> {
+    using _value     = std::conditional_t<std::is_void_v<V>, std::remove_cvref_t<Ref>, V>;
+    using _reference = std::conditional_t<std::is_void_v<V>, Ref &&, Ref>;
+
+public:
+    using yielded = std::conditional_t<std::is_reference_v<_reference>, _reference, _reference const &>;
+
+    class promise_type : public detail::_promise_allocation<Allocator> {
+        friend generator;
+
+        std::add_pointer_t<yielded> _m_value = nullptr;
+        std::exception_ptr          _m_except;
+
+        // Yielding an lvalue when 'yielded' is an rvalue reference ... the copy lives in the frame while suspended
+        struct _CopyAwaiter {
+            std::remove_cvref_t<yielded> copy;
+
+            constexpr bool
+            await_ready() const noexcept {
+                return false;
+            }
+            void
+            await_suspend(std::coroutine_handle<promise_type> hndl) noexcept {
+                hndl.promise()._m_value = std::addressof(copy);
+            }
+            constexpr void
+            await_resume() const noexcept {}
+        };
+
+    public:
+        generator
+        get_return_object() noexcept {
+            return generator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always
+        initial_suspend() const noexcept {
+            return {};
+        }
+        std::suspend_always
+        final_suspend() noexcept {
+            return {};
+        }
+
+        std::suspend_always
+        yield_value(yielded val) noexcept {
+            _m_value = std::addressof(val);
+            return {};
+        }
+        auto
+        yield_value(std::remove_reference_t<yielded> const &lval)
+        requires std::is_rvalue_reference_v<yielded> &&
+                 std::constructible_from<std::remove_cvref_t<yielded>, std::remove_reference_t<yielded> const &>
+        {
+            return _CopyAwaiter{std::remove_cvref_t<yielded>(lval)};
+        }
+
+        // Generators are synchronous, nothing to 'co_await' on
+        template <typename U>
+        std::suspend_never
+        await_transform(U &&) = delete;
+
+        void
+        return_void() const noexcept {}
+        void
+        unhandled_exception() {
+            _m_except = std::current_exception();
+        }
+    };
+
+    class iterator {
+        friend generator;
+
+        std::coroutine_handle<promise_type> _m_hndl;
+
+        explicit iterator(std::coroutine_handle<promise_type> hndl) noexcept : _m_hndl(hndl) {}
+
+    public:
+        using value_type      = _value;
+        using difference_type = std::ptrdiff_t;
+
+        iterator(iterator &&other) noexcept : _m_hndl(std::exchange(other._m_hndl, {})) {}
+        iterator &
+        operator=(iterator &&other) noexcept {
+            _m_hndl = std::exchange(other._m_hndl, {});
+            return *this;
+        }
+
+        _reference
+        operator*() const noexcept(std::is_nothrow_copy_constructible_v<_reference>) {
+            return static_cast<_reference>(*_m_hndl.promise()._m_value);
+        }
+
+        iterator &
+        operator++() {
+            _m_hndl.resume();
+            _rethrow_ifAny(_m_hndl);
+            return *this;
+        }
+        void
+        operator++(int) {
+            ++*this;
+        }
+
+        friend bool
+        operator==(iterator const &it, std::default_sentinel_t) noexcept {
+            return it._m_hndl.done();
+        }
+    };
+
+
+private:
+    std::coroutine_handle<promise_type> _m_hndl;
+
+    explicit generator(std::coroutine_handle<promise_type> hndl) noexcept : _m_hndl(hndl) {}
+
+    static void
+    _rethrow_ifAny(std::coroutine_handle<promise_type> hndl) {
+        if (hndl.done() && hndl.promise()._m_except) { std::rethrow_exception(std::move(hndl.promise()._m_except)); }
+    }
+
+public:
+    generator(generator const &) = delete;
+    generator(generator &&other) noexcept : _m_hndl(std::exchange(other._m_hndl, {})) {}
+
+    generator &
+    operator=(generator other) noexcept {
+        std::swap(_m_hndl, other._m_hndl);
+        return *this;
+    }
+
+    ~generator() {
+        if (_m_hndl) { _m_hndl.destroy(); }
+    }
+
+    // Can be called only once (input range)
+    iterator
+    begin() {
+        _m_hndl.resume();
+        _rethrow_ifAny(_m_hndl);
+        return iterator(_m_hndl);
+    }
+
+    std::default_sentinel_t
+    end() const noexcept {
+        return std::default_sentinel;
+    }
+};
+
+
+namespace detail {
+template <typename T>
+struct _task_result {
+    std::variant<std::monostate, T, std::exception_ptr> m_res;
+
+    template <typename U>
+    void
+    return_value(U &&val) {
+        m_res.template emplace<1>(std::forward<U>(val));
+    }
+    void
+    unhandled_exception() noexcept {
+        m_res.template emplace<2>(std::current_exception());
+    }
+    T
+    get_result() {
+        if (m_res.index() == 2) { std::rethrow_exception(std::get<2>(m_res)); }
+        return std::move(std::get<1>(m_res));
+    }
+};
+template <typename T>
+struct _task_result<T &> {
+    std::variant<std::monostate, T *, std::exception_ptr> m_res;
+
+    void
+    return_value(T &val) noexcept {
+        m_res.template emplace<1>(std::addressof(val));
+    }
+    void
+    unhandled_exception() noexcept {
+        m_res.template emplace<2>(std::current_exception());
+    }
+    T &
+    get_result() {
+        if (m_res.index() == 2) { std::rethrow_exception(std::get<2>(m_res)); }
+        return *std::get<1>(m_res);
+    }
+};
+template <>
+struct _task_result<void> {
+    std::exception_ptr m_except;
+
+    void
+    return_void() noexcept {}
+    void
+    unhandled_exception() noexcept {
+        m_except = std::current_exception();
+    }
+    void
+    get_result() {
+        if (m_except) { std::rethrow_exception(m_except); }
+    }
+};
+
+// How results get stored by 'when_all' and 'sync_wait'
+template <typename T>
+using _stored_t = std::conditional_t<
+    std::is_void_v<T>, std::monostate,
+    std::conditional_t<std::is_reference_v<T>, std::reference_wrapper<std::remove_reference_t<T>>, T>>;
+} // namespace detail
+
+
+// Lazy coroutine task, starts when awaited and resumes the awaiter when done (symmetric transfer, no stack growth)
+// Where it runs depends on what it awaits ... 'co_await pool.schedule()' moves it onto a ThreadPool
+// Frames can come from an allocator just like with 'generator' ('std::allocator_arg_t, Alloc const &' first)
+template <typename T = void>
+class [[nodiscard]] task {
+public:
+    class promise_type : public detail::_promise_allocation<void>, public detail::_task_result<T> {
+        friend task;
+
+        std::coroutine_handle<> _m_continuation = std::noop_coroutine();
+
+        struct _FinalAwaiter {
+            constexpr bool
+            await_ready() const noexcept {
+                return false;
+            }
+            std::coroutine_handle<>
+            await_suspend(std::coroutine_handle<promise_type> hndl) noexcept {
+                return hndl.promise()._m_continuation;
+            }
+            constexpr void
+            await_resume() const noexcept {}
+        };
+
+    public:
+        task
+        get_return_object() noexcept {
+            return task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always
+        initial_suspend() const noexcept {
+            return {};
+        }
+        _FinalAwaiter
+        final_suspend() noexcept {
+            return {};
+        }
+    };
+
+
+private:
+    std::coroutine_handle<promise_type> _m_hndl;
+
+    explicit task(std::coroutine_handle<promise_type> hndl) noexcept : _m_hndl(hndl) {}
+
+    struct _Awaiter {
+        std::coroutine_handle<promise_type> hndl;
+
+        bool
+        await_ready() const noexcept {
+            return not hndl || hndl.done();
+        }
+        std::coroutine_handle<>
+        await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            hndl.promise()._m_continuation = awaiting;
+            return hndl;
+        }
+        decltype(auto)
+        await_resume() {
+            return hndl.promise().get_result();
+        }
+    };
+
+public:
+    task(task const &) = delete;
+    task(task &&other) noexcept : _m_hndl(std::exchange(other._m_hndl, {})) {}
+
+    task &
+    operator=(task other) noexcept {
+        std::swap(_m_hndl, other._m_hndl);
+        return *this;
+    }
+
+    ~task() {
+        if (_m_hndl) { _m_hndl.destroy(); }
+    }
+
+    bool
+    is_ready() const noexcept {
+        return not _m_hndl || _m_hndl.done();
+    }
+
+    // Single shot, the result is moved out
+    _Awaiter
+    operator co_await() && noexcept {
+        return _Awaiter{_m_hndl};
+    }
+    _Awaiter
+    operator co_await() & noexcept {
+        return _Awaiter{_m_hndl};
+    }
+};
+
+
+// Work-stealing thread pool for resuming coroutines
+// Every worker has its own deque (owner pushes and pops at the back, thieves steal from the front), anything enqueued
+// from outside of the pool goes to the global injection queue. Idle workers sleep on a condition variable
+// On destruction everything already enqueued gets run before the workers are joined
+class ThreadPool {
+    struct _Worker {
+        std::mutex                          mtx;
+        std::deque<std::coroutine_handle<>> queue;
+    };
+
+    static inline thread_local ThreadPool *_t_curPool     = nullptr;
+    static inline thread_local size_t      _t_curWorkerID = 0;
+
+    std::vector<std::unique_ptr<_Worker>> _m_workers;
+    std::mutex                            _m_globalMtx;
+    std::deque<std::coroutine_handle<>>   _m_globalQueue;
+
+    std::atomic<size_t>     _m_pending{0};
+    std::mutex              _m_sleepMtx;
+    std::condition_variable _m_sleepCV;
+    bool                    _m_stop = false; // Guarded by '_m_sleepMtx'
+
+    std::vector<std::thread> _m_threads;
+
+    struct _ScheduleAwaiter {
+        ThreadPool *pool;
+
+        constexpr bool
+        await_ready() const noexcept {
+            return false;
+        }
+        void
+        await_suspend(std::coroutine_handle<> hndl) {
+            pool->enqueue(hndl);
+        }
+        constexpr void
+        await_resume() const noexcept {}
+    };
+
+public:
+    explicit ThreadPool(size_t threadCount = std::max(1u, std::thread::hardware_concurrency())) {
+        threadCount = std::max(threadCount, 1uz);
+        for (size_t i = 0; i < threadCount; ++i) { _m_workers.push_back(std::make_unique<_Worker>()); }
+        for (size_t i = 0; i < threadCount; ++i) { _m_threads.emplace_back([this, i] { _run(i); }); }
+    }
+
+    //    NOT copiable or movable, workers and suspended coroutines hold pointers to it
+    ThreadPool(ThreadPool const &) = delete;
+    ThreadPool &
+    operator=(ThreadPool const &) = delete;
+
+    ~ThreadPool() {
+        {
+            std::scoped_lock lock(_m_sleepMtx);
+            _m_stop = true;
+        }
+        _m_sleepCV.notify_all();
+        for (auto &thr : _m_threads) { thr.join(); }
+    }
+
+    // 'co_await pool.schedule()' continues the coroutine on one of the pool's threads
+    [[nodiscard]] _ScheduleAwaiter
+    schedule() noexcept {
+        return _ScheduleAwaiter{this};
+    }
+
+    void
+    enqueue(std::coroutine_handle<> hndl) {
+        if (_t_curPool == this) {
+            _Worker          &wrkr = *_m_workers[_t_curWorkerID];
+            std::scoped_lock lock(wrkr.mtx);
+            wrkr.queue.push_back(hndl);
+        }
+        else {
+            std::scoped_lock lock(_m_globalMtx);
+            _m_globalQueue.push_back(hndl);
+        }
+        _m_pending.fetch_add(1, std::memory_order_release);
+        {
+            // Empty critical section ... a worker that just checked '_m_pending' is either already waiting or will
+            // see the new value, so the notification cannot get lost
+            std::scoped_lock lock(_m_sleepMtx);
+        }
+        _m_sleepCV.notify_one();
+    }
+
+    size_t
+    thread_count() const noexcept {
+        return _m_threads.size();
+    }
+
+    // True when called from one of this pool's worker threads
+    bool
+    is_onWorkerThread() const noexcept {
+        return _t_curPool == this;
+    }
+
+private:
+    void
+    _run(size_t workerID) {
+        _t_curPool     = this;
+        _t_curWorkerID = workerID;
+
+        while (true) {
+            if (auto hndl = _try_pop(workerID)) {
+                _m_pending.fetch_sub(1, std::memory_order_relaxed);
+                hndl.resume();
+                continue;
+            }
+            std::unique_lock lock(_m_sleepMtx);
+            _m_sleepCV.wait(lock, [&] { return _m_stop || _m_pending.load(std::memory_order_acquire) != 0; });
+            if (_m_stop && _m_pending.load(std::memory_order_acquire) == 0) { return; }
+        }
+    }
+
+    // Own deque first (LIFO, the freshest work is the cache-hot one), then the global queue, then steal (FIFO)
+    std::coroutine_handle<>
+    _try_pop(size_t workerID) {
+        {
+            _Worker         &own = *_m_workers[workerID];
+            std::scoped_lock lock(own.mtx);
+            if (not own.queue.empty()) {
+                auto res = own.queue.back();
+                own.queue.pop_back();
+                return res;
+            }
+        }
+        {
+            std::scoped_lock lock(_m_globalMtx);
+            if (not _m_globalQueue.empty()) {
+                auto res = _m_globalQueue.front();
+                _m_globalQueue.pop_front();
+                return res;
+            }
+        }
+        for (size_t i = 1; i < _m_workers.size(); ++i) {
+            _Worker         &victim = *_m_workers[(workerID + i) % _m_workers.size()];
+            std::scoped_lock lock(victim.mtx);
+            if (not victim.queue.empty()) {
+                auto res = victim.queue.front();
+                victim.queue.pop_front();
+                return res;
+            }
+        }
+        return {};
+    }
+};
+
+// One pool (with 'hardware_concurrency' threads) shared by everything that doesn't need its own
+inline ThreadPool &
+shared_pool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+
+namespace detail {
+// Helper coroutine that starts (and completes) the awaited tasks for 'when_all' and 'sync_wait'
+// Calls 'F_OnDone' at the very end, the frame is destroyed by the owner of the helper
+template <typename F_OnDone>
+class _NotifyingTask {
+public:
+    class promise_type {
+        friend _NotifyingTask;
+
+        F_OnDone *_m_onDone = nullptr;
+
+        struct _FinalAwaiter {
+            constexpr bool
+            await_ready() const noexcept {
+                return false;
+            }
+            std::coroutine_handle<>
+            await_suspend(std::coroutine_handle<promise_type> hndl) noexcept {
+                return (*hndl.promise()._m_onDone)();
+            }
+            constexpr void
+            await_resume() const noexcept {}
+        };
+
+    public:
+        _NotifyingTask
+        get_return_object() noexcept {
+            return _NotifyingTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always
+        initial_suspend() const noexcept {
+            return {};
+        }
+        _FinalAwaiter
+        final_suspend() noexcept {
+            return {};
+        }
+        void
+        return_void() const noexcept {}
+        [[noreturn]] void
+        unhandled_exception() const noexcept {
+            std::terminate(); // Exceptions are caught inside of the helpers
+        }
+    };
+
+private:
+    std::coroutine_handle<promise_type> _m_hndl;
+
+    explicit _NotifyingTask(std::coroutine_handle<promise_type> hndl) noexcept : _m_hndl(hndl) {}
+
+public:
+    _NotifyingTask(_NotifyingTask &&other) noexcept : _m_hndl(std::exchange(other._m_hndl, {})) {}
+    ~_NotifyingTask() {
+        if (_m_hndl) { _m_hndl.destroy(); }
+    }
+
+    void
+    start(F_OnDone &onDone) {
+        _m_hndl.promise()._m_onDone = &onDone;
+        _m_hndl.resume();
+    }
+};
+
+// The last one to finish (the tasks or the awaiting 'when_all' itself) resumes the awaiting coroutine
+struct _WhenAllCounter {
+    std::atomic<size_t>     count;
+    std::coroutine_handle<> continuation;
+
+    std::coroutine_handle<>
+    operator()() noexcept {
+        return count.fetch_sub(1, std::memory_order_acq_rel) == 1 ? continuation : std::noop_coroutine();
+    }
+};
+
+// First exception from any of the tasks wins, the rest are dropped
+struct _FirstException {
+    std::atomic<bool>  isSet{false};
+    std::exception_ptr except;
+
+    void
+    set(std::exception_ptr exPtr) noexcept {
+        if (not isSet.exchange(true, std::memory_order_acq_rel)) { except = std::move(exPtr); }
+    }
+    void
+    rethrow_ifSet() {
+        if (except) { std::rethrow_exception(except); }
+    }
+};
+
+template <typename F_OnDone, typename T>
+_NotifyingTask<F_OnDone>
+_await_into(task<T> &tsk, std::optional<_stored_t<T>> &res, _FirstException &firstExcept) {
+    try {
+        if constexpr (std::is_void_v<T>) {
+            co_await tsk;
+            res.emplace();
+        }
+        else { res.emplace(co_await tsk); }
+    }
+    catch (...) {
+        firstExcept.set(std::current_exception());
+    }
+}
+
+template <typename ITEMS>
+struct _WhenAllAwaiter {
+    _WhenAllCounter &counter;
+    ITEMS           &items;
+
+    constexpr bool
+    await_ready() const noexcept {
+        return false;
+    }
+    bool
+    await_suspend(std::coroutine_handle<> hndl) {
+        counter.continuation = hndl;
+        std::apply([&](auto &...item) { (item.start(counter), ...); }, items);
+        return counter.count.fetch_sub(1, std::memory_order_acq_rel) != 1;
+    }
+    constexpr void
+    await_resume() const noexcept {}
+};
 } // namespace detail
-} // namespace incom::standard::coroutines
\ No newline at end of file
+
+
+// Awaits all the tasks concurrently (they run wherever they 'schedule' themselves), void results become monostate
+// If any of them throws the (first) exception is rethrown after all of them finished
+template <typename... Ts>
+task<std::tuple<detail::_stored_t<Ts>...>>
+when_all(task<Ts>... tasks) {
+    std::tuple<std::optional<detail::_stored_t<Ts>>...> results;
+    detail::_FirstException                              firstExcept;
+    detail::_WhenAllCounter                              counter{sizeof...(Ts) + 1, {}};
+
+    auto items = [&]<size_t... Is>(std::index_sequence<Is...>, auto &&taskRefs) {
+        return std::tuple{detail::_await_into<detail::_WhenAllCounter>(std::get<Is>(taskRefs), std::get<Is>(results),
+                                                                         firstExcept)...};
+    }(std::index_sequence_for<Ts...>{}, std::tie(tasks...));
+    co_await detail::_WhenAllAwaiter<decltype(items)>{counter, items};
+
+    firstExcept.rethrow_ifSet();
+    co_return std::apply([](auto &...res) { return std::tuple{std::move(*res)...}; }, results);
+}
+
+// Overload: Any number of tasks of the same type
+template <typename T>
+task<std::conditional_t<std::is_void_v<T>, void, std::vector<detail::_stored_t<T>>>>
+when_all(std::vector<task<T>> tasks) {
+    std::vector<std::optional<detail::_stored_t<T>>> results(tasks.size());
+    detail::_FirstException                           firstExcept;
+    detail::_WhenAllCounter                           counter{tasks.size() + 1, {}};
+
+    std::tuple<std::vector<detail::_NotifyingTask<detail::_WhenAllCounter>>> items;
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        std::get<0>(items).push_back(detail::_await_into<detail::_WhenAllCounter>(tasks[i], results[i], firstExcept));
+    }
+    struct _StartAll {
+        std::vector<detail::_NotifyingTask<detail::_WhenAllCounter>> &items;
+        void
+        start(detail::_WhenAllCounter &counter) {
+            for (auto &item : items) { item.start(counter); }
+        }
+    };
+    auto starter = std::tuple{_StartAll{std::get<0>(items)}};
+    co_await detail::_WhenAllAwaiter<decltype(starter)>{counter, starter};
+
+    firstExcept.rethrow_ifSet();
+    if constexpr (not std::is_void_v<T>) {
+        std::vector<detail::_stored_t<T>> res;
+        res.reserve(results.size());
+        for (auto &oneRes : results) { res.push_back(std::move(*oneRes)); }
+        co_return res;
+    }
+}
+
+
+namespace detail {
+// Notifies under the lock, so the waiting thread cannot destroy it while 'notify_one' is still running
+struct _SyncWaitSignal {
+    std::mutex              mtx;
+    std::condition_variable condVar;
+    bool                    isDone = false;
+
+    std::coroutine_handle<>
+    operator()() noexcept {
+        std::scoped_lock lock(mtx);
+        isDone = true;
+        condVar.notify_one();
+        return std::noop_coroutine();
+    }
+
+    void
+    wait() {
+        std::unique_lock lock(mtx);
+        condVar.wait(lock, [&] { return isDone; });
+    }
+};
+} // namespace detail
+
+// Blocks the calling thread until the task finishes, returns its result (or rethrows its exception)
+// Must not be called from a pool thread the task needs to make progress
+template <typename T>
+T
+sync_wait(task<T> tsk) {
+    std::optional<detail::_stored_t<T>> res;
+    detail::_FirstException              except;
+    detail::_SyncWaitSignal              signal;
+
+    auto helper = detail::_await_into<detail::_SyncWaitSignal>(tsk, res, except);
+    helper.start(signal);
+    signal.wait();
+
+    except.rethrow_ifSet();
+    if constexpr (not std::is_void_v<T>) { return std::move(*res); }
+}
+
+
+namespace detail {
+template <typename F>
+task<void>
+_run_onPool(ThreadPool &pool, F const &func, size_t id) {
+    co_await pool.schedule();
+    func(id);
+}
+} // namespace detail
+
+// Runs 'func(0)' ... 'func(count - 1)' on the pool and blocks until all of them finished
+// The first exception thrown by any of them is rethrown
+// Runs inline on the calling thread for a single item, or when called from one of the pool's own workers (blocking
+// that worker in 'sync_wait' on work queued to the same pool could deadlock)
+template <typename F>
+void
+parallel_for(ThreadPool &pool, size_t count, F const &func) {
+    if (count <= 1 || pool.is_onWorkerThread()) {
+        for (size_t i = 0; i < count; ++i) { func(i); }
+        return;
+    }
+    std::vector<task<void>> tasks;
+    tasks.reserve(count);
+    for (size_t i = 0; i < count; ++i) { tasks.push_back(detail::_run_onPool(pool, func, i)); }
+    sync_wait(when_all(std::move(tasks)));
+}
+
+// Pool that an algorithm called with the execution policy 'EP' should run on, nullptr means run sequentially
+// Also nullptr on the shared pool's own workers, nested parallel algorithms just run sequentially there
+template <typename EP>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>>
+ThreadPool *
+pool_forPolicy() {
+    if constexpr (std::is_same_v<std::remove_cvref_t<EP>, std::execution::sequenced_policy>) { return nullptr; }
+    else { return shared_pool().is_onWorkerThread() ? nullptr : &shared_pool(); }
+}
+
+} // namespace incom::standard::coroutines
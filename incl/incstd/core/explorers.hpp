@@ -1,41 +1,291 @@
 #pragma once
 
 #include <algorithm>
-#include <deque>
+#include <array>
+#include <atomic>
+#include <barrier>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory_resource>
+#include <span>
+#include <thread>
 #include <vector>
 
+#include <incstd/core/coroutines.hpp>
 #include <incstd/polyfills/mdspan.hpp>
 
 
 namespace incom::standard::explorers {
 using namespace incom::standard;
 
-// Explores 'Dims-dimensional' space in Chebyshev-layered fashion (as if by chessboard distance)
-template <typename F_Allowed, size_t Dims>
-requires(Dims > 0) && requires(F_Allowed f, std::array<size_t, Dims> const &item) {
-    { f(item) } -> std::same_as<bool>; // The F_Allowed need to be able to take 'Pos_t const&'
-}
-class Chebyshev {
+// Custom mdspan layout policies for the visited storage (and anything else indexed by position)
+// BFS-like layers touch positions spread across many rows, with these the neighbours mostly stay in the same cache line
+
+// Area is split into 'TileSz^Rank' sized tiles, tiles are row-major and so are the positions inside each tile
+// For the bitset visited map 'TileSz' of 8 (in 2D) or 4 (in 3D) makes one tile exactly one 64bit word
+template <size_t TileSz>
+requires(TileSz > 0)
+struct layout_tiled {
+    template <class Extents>
+    class mapping {
+    public:
+        using extents_type = Extents;
+        using index_type   = typename Extents::index_type;
+        using rank_type    = typename Extents::rank_type;
+        using layout_type  = layout_tiled;
+
+    private:
+        static constexpr index_type c_tileVolume = [] {
+            index_type res = 1;
+            for (rank_type r = 0; r < Extents::rank(); ++r) { res *= TileSz; }
+            return res;
+        }();
+
+        extents_type _m_extents{};
+
+    public:
+        constexpr mapping() noexcept = default;
+        constexpr mapping(extents_type const &ext) noexcept : _m_extents(ext) {}
+
+        constexpr extents_type const &
+        extents() const noexcept {
+            return _m_extents;
+        }
+
+        template <class... Indices>
+        requires(sizeof...(Indices) == Extents::rank())
+        constexpr index_type
+        operator()(Indices... ids) const noexcept {
+            std::array<index_type, Extents::rank()> const idx{static_cast<index_type>(ids)...};
+
+            index_type tileID = 0, inTileID = 0;
+            for (rank_type r = 0; r < Extents::rank(); ++r) {
+                tileID   = tileID * _tilesIn(r) + idx[r] / TileSz;
+                inTileID = inTileID * TileSz + idx[r] % TileSz;
+            }
+            return tileID * c_tileVolume + inTileID;
+        }
+
+        constexpr index_type
+        required_span_size() const noexcept {
+            index_type res = c_tileVolume;
+            for (rank_type r = 0; r < Extents::rank(); ++r) {
+                if (_m_extents.extent(r) == 0) { return 0; }
+                res *= _tilesIn(r);
+            }
+            return res;
+        }
+
+        static constexpr bool
+        is_always_unique() noexcept {
+            return true;
+        }
+        static constexpr bool
+        is_always_exhaustive() noexcept {
+            return TileSz == 1;
+        }
+        static constexpr bool
+        is_always_strided() noexcept {
+            return TileSz == 1;
+        }
+        static constexpr bool
+        is_unique() noexcept {
+            return true;
+        }
+        constexpr bool
+        is_exhaustive() const noexcept {
+            for (rank_type r = 0; r < Extents::rank(); ++r) {
+                if (_m_extents.extent(r) % TileSz != 0) { return false; }
+            }
+            return true;
+        }
+        static constexpr bool
+        is_strided() noexcept {
+            return TileSz == 1;
+        }
+
+        friend constexpr bool
+        operator==(mapping const &, mapping const &) = default;
 
+    private:
+        constexpr index_type
+        _tilesIn(rank_type r) const noexcept {
+            return (_m_extents.extent(r) + TileSz - 1) / TileSz;
+        }
+    };
+};
+
+// Z-order (Morton) layout, bits of the indices are interleaved (last dimension the least significant)
+// Locality at every scale without picking a tile size, but 'required_span_size' is the next power of 2 per dimension
+// of the largest extent ... can waste a lot on elongated areas. 'Rank * bits of the largest index' must fit 64 bits
+struct layout_morton {
+    template <class Extents>
+    class mapping {
+    public:
+        using extents_type = Extents;
+        using index_type   = typename Extents::index_type;
+        using rank_type    = typename Extents::rank_type;
+        using layout_type  = layout_morton;
+
+    private:
+        extents_type _m_extents{};
+
+    public:
+        constexpr mapping() noexcept = default;
+        constexpr mapping(extents_type const &ext) noexcept : _m_extents(ext) {}
+
+        constexpr extents_type const &
+        extents() const noexcept {
+            return _m_extents;
+        }
+
+        template <class... Indices>
+        requires(sizeof...(Indices) == Extents::rank())
+        constexpr index_type
+        operator()(Indices... ids) const noexcept {
+            return _encode(std::array<index_type, Extents::rank()>{static_cast<index_type>(ids)...});
+        }
+
+        constexpr index_type
+        required_span_size() const noexcept {
+            std::array<index_type, Extents::rank()> maxIDs{};
+            for (rank_type r = 0; r < Extents::rank(); ++r) {
+                if (_m_extents.extent(r) == 0) { return 0; }
+                maxIDs[r] = _m_extents.extent(r) - 1;
+            }
+            return _encode(maxIDs) + 1;
+        }
+
+        static constexpr bool
+        is_always_unique() noexcept {
+            return true;
+        }
+        static constexpr bool
+        is_always_exhaustive() noexcept {
+            return Extents::rank() < 2;
+        }
+        static constexpr bool
+        is_always_strided() noexcept {
+            return Extents::rank() < 2;
+        }
+        static constexpr bool
+        is_unique() noexcept {
+            return true;
+        }
+        constexpr bool
+        is_exhaustive() const noexcept {
+            index_type total = 1;
+            for (rank_type r = 0; r < Extents::rank(); ++r) { total *= _m_extents.extent(r); }
+            return required_span_size() == total;
+        }
+        static constexpr bool
+        is_strided() noexcept {
+            return Extents::rank() < 2;
+        }
+
+        friend constexpr bool
+        operator==(mapping const &, mapping const &) = default;
+
+    private:
+        static constexpr index_type
+        _encode(std::array<index_type, Extents::rank()> const &idx) noexcept {
+            index_type res = 0;
+            for (rank_type r = 0; r < Extents::rank(); ++r) {
+                res |= _spread(idx[r]) << (Extents::rank() - 1 - r);
+            }
+            return res;
+        }
+
+        // Inserts 'Rank - 1' zero bits between the bits of 'v'
+        static constexpr index_type
+        _spread(index_type v) noexcept {
+            std::uint64_t x = static_cast<std::uint64_t>(v);
+            if constexpr (Extents::rank() == 1) { return v; }
+            else if constexpr (Extents::rank() == 2) {
+                x &= 0xFFFFFFFFull;
+                x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+                x = (x | (x << 8)) & 0x00FF00FF00FF00FFull;
+                x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0Full;
+                x = (x | (x << 2)) & 0x3333333333333333ull;
+                x = (x | (x << 1)) & 0x5555555555555555ull;
+            }
+            else if constexpr (Extents::rank() == 3) {
+                x &= 0x1FFFFFull;
+                x = (x | (x << 32)) & 0x1F00000000FFFFull;
+                x = (x | (x << 16)) & 0x1F0000FF0000FFull;
+                x = (x | (x << 8)) & 0x100F00F00F00F00Full;
+                x = (x | (x << 4)) & 0x10C30C30C30C30C3ull;
+                x = (x | (x << 2)) & 0x1249249249249249ull;
+            }
+            else {
+                std::uint64_t res = 0;
+                for (size_t bit = 0; x != 0; ++bit, x >>= 1) { res |= (x & 1ull) << (bit * Extents::rank()); }
+                x = res;
+            }
+            return static_cast<index_type>(x);
+        }
+    };
+};
+
+
+namespace detail {
 #if defined(INCSTD_MDSPAN_UNDER_KOKKOS)
-    template <class IndexType, size_t Rank>
-    using pf_dextents = Kokkos::dextents<IndexType, Rank>;
+template <class IndexType, size_t Rank>
+using pf_dextents = Kokkos::dextents<IndexType, Rank>;
 
-    template <class ElementType, class Extents>
-    using pf_mdspan = Kokkos::mdspan<ElementType, Extents>;
+using pf_layout_right = Kokkos::layout_right;
 #else
-    template <class IndexType, size_t Rank>
-    using pf_dextents = std::dextents<IndexType, Rank>;
+template <class IndexType, size_t Rank>
+using pf_dextents = std::dextents<IndexType, Rank>;
 
-    template <class ElementType, class Extents>
-    using pf_mdspan = std::mdspan<ElementType, Extents>;
+using pf_layout_right = std::layout_right;
 #endif
 
 
+// Distance metrics ... decide in which order the positions are explored
+struct _ChebyshevDist {
+    template <size_t Dims>
+    static constexpr size_t
+    compute(std::array<size_t, Dims> const &a, std::array<size_t, Dims> const &b) {
+        size_t res = 0uz;
+        for (size_t i = 0; i < Dims; ++i) { res = std::max(res, (a[i] > b[i] ? a[i] - b[i] : b[i] - a[i])); }
+        return res;
+    }
+};
+struct _ManhattanDist {
+    template <size_t Dims>
+    static constexpr size_t
+    compute(std::array<size_t, Dims> const &a, std::array<size_t, Dims> const &b) {
+        size_t res = 0uz;
+        for (size_t i = 0; i < Dims; ++i) { res += (a[i] > b[i] ? a[i] - b[i] : b[i] - a[i]); }
+        return res;
+    }
+};
+struct _EuclideanSqDist {
+    template <size_t Dims>
+    static constexpr size_t
+    compute(std::array<size_t, Dims> const &a, std::array<size_t, Dims> const &b) {
+        size_t res = 0uz;
+        for (size_t i = 0; i < Dims; ++i) {
+            size_t const diff = (a[i] > b[i] ? a[i] - b[i] : b[i] - a[i]);
+            res += diff * diff;
+        }
+        return res;
+    }
+};
+
+
+// Shared base of all the explorers
+// Holds the area, the F_Allowed and the visited map ('Layout' is the mdspan layout policy of the visited map)
+template <typename F_Allowed, size_t Dims, typename Layout>
+class _GridExplorer {
 public:
     using Pos_t   = std::array<size_t, Dims>;
     using Extents = pf_dextents<size_t, Dims>;
-    using View_t  = pf_mdspan<char, Extents>;
+    using Mapping = typename Layout::template mapping<Extents>;
 
     using DirChngs_t = std::array<Pos_t, Dims * 2>;
 
@@ -55,40 +305,25 @@ public:
     Pos_t m_areaMins_perDim;
     Pos_t m_startPos;
 
-    std::vector<char> m_visited_storage;
-    View_t            m_visited;
+    // All the dynamic storage comes from 'memRes' (supplied on construction) ... can be an arena or a pool
+    // Visited map is a packed bitset (1 bit per position) addressed through the 'm_visitedMapping'
+    // 'm_touchedWords' lists the words that have any bit set, so that 'reset' only clears those
+    Mapping                         m_visitedMapping;
+    std::pmr::vector<std::uint64_t> m_visitedBits;
+    std::pmr::vector<size_t>        m_touchedWords;
 
     F_Allowed m_f_allowed;
 
-    std::vector<std::deque<Pos_t>> m_VofQueues;
-    size_t                         m_queuedCount;
-    size_t                         m_queueIDToUseNext = 0uz;
-
 
-public:
-    Chebyshev(Pos_t startPos, Pos_t areaSzs)
-        : m_areaSzs_perDim(std::move(areaSzs)), m_areaMins_perDim{}, m_startPos(startPos),
-          m_visited_storage(_ctor_total_sz(m_areaSzs_perDim), '.'),
-          m_visited(m_visited_storage.data(), _ctor_make_extents(m_areaSzs_perDim)), m_f_allowed{},
-          m_VofQueues(1, std::deque<Pos_t>{std::move(startPos)}), m_queuedCount(1uz) {}
-
-    // F_allowed is a unary functor(lambda) taking std::array<size_t, Dims> const &
-    Chebyshev(F_Allowed &&f, Pos_t startPos, Pos_t areaSzs)
-        : m_areaSzs_perDim(std::move(areaSzs)), m_areaMins_perDim{}, m_startPos(startPos),
-          m_visited_storage(_ctor_total_sz(m_areaSzs_perDim), '.'),
-          m_visited(m_visited_storage.data(), _ctor_make_extents(m_areaSzs_perDim)),
-          m_f_allowed(std::forward<F_Allowed>(f)), m_VofQueues(1, std::deque<Pos_t>{std::move(startPos)}),
-          m_queuedCount(1uz) {}
-
-    // F_allowed is a unary functor(lambda) taking std::array<size_t, Dims> const &
-    Chebyshev(F_Allowed &&f, Pos_t startPos, Pos_t areaSzs, Pos_t areaMins)
+protected:
+    _GridExplorer(F_Allowed &&f, Pos_t startPos, Pos_t areaSzs, Pos_t areaMins, std::pmr::memory_resource *memRes)
         : m_areaSzs_perDim(std::move(areaSzs)), m_areaMins_perDim{std::move(areaMins)}, m_startPos(startPos),
-          m_visited_storage(_ctor_total_sz(m_areaSzs_perDim), '.'),
-          m_visited(m_visited_storage.data(), _ctor_make_extents(m_areaSzs_perDim)),
-          m_f_allowed(std::forward<F_Allowed>(f)), m_VofQueues(1, std::deque<Pos_t>{std::move(startPos)}),
-          m_queuedCount(1uz) {}
+          m_visitedMapping(_ctor_make_extents(m_areaSzs_perDim)),
+          m_visitedBits((m_visitedMapping.required_span_size() + 63uz) / 64uz, std::uint64_t{0}, memRes),
+          m_touchedWords(memRes), m_f_allowed(std::forward<F_Allowed>(f)) {}
 
 
+public:
     bool
     is_inArea(Pos_t const &p) {
         return [&]<size_t... Is>(Pos_t const &p, std::index_sequence<Is...>) {
@@ -98,16 +333,138 @@ public:
 
     void
     visit_at(Pos_t const &p) {
-        [&]<size_t... Is>(Pos_t const &p, std::index_sequence<Is...>) -> void {
-            m_visited[p[Is]...] = 2;
-        }(p, c_IDs_sequence);
+        size_t const id   = _linearID(p);
+        auto        &word = m_visitedBits[id >> 6];
+        if (word == 0uz) { m_touchedWords.push_back(id >> 6); }
+        word |= (std::uint64_t{1} << (id & 63uz));
     }
 
     bool
     is_alreadyVisited(Pos_t const &p) {
-        return [&]<size_t... Is>(Pos_t const &p, std::index_sequence<Is...>) -> bool {
-            return m_visited[p[Is]...] != '.';
-        }(p, c_IDs_sequence);
+        size_t const id = _linearID(p);
+        return (m_visitedBits[id >> 6] >> (id & 63uz)) & 1uz;
+    }
+
+
+protected:
+    size_t
+    _linearID(Pos_t const &p) const {
+        return [&]<size_t... Is>(std::index_sequence<Is...>) -> size_t {
+            return m_visitedMapping(p[Is]...);
+        }(c_IDs_sequence);
+    }
+
+    // O(positions visited so far), falls back to clearing everything when most of it was visited
+    void
+    _clear_visited() {
+        if (m_touchedWords.size() * 4uz > m_visitedBits.size()) { std::ranges::fill(m_visitedBits, 0uz); }
+        else {
+            for (auto const wordID : m_touchedWords) { m_visitedBits[wordID] = 0uz; }
+        }
+        m_touchedWords.clear();
+    }
+
+    static constexpr Pos_t
+    _moved(Pos_t pos, Pos_t const &dirChange) {
+        [&]<size_t... Is>(std::index_sequence<Is...>) { ((pos[Is] += dirChange[Is]), ...); }(c_IDs_sequence);
+        return pos;
+    }
+
+    static Extents
+    _ctor_make_extents(Pos_t const &sizes) {
+        return [&]<size_t... Is>(std::index_sequence<Is...>) { return Extents(sizes[Is]...); }(c_IDs_sequence);
+    }
+
+    static constexpr Pos_t
+    make_filledPos_size_t() {
+        return [&]<size_t... Is>(std::index_sequence<Is...>) {
+            return Pos_t{((void)Is, std::numeric_limits<size_t>::max())...};
+        }(std::make_index_sequence<Dims>{});
+    }
+};
+
+
+// Explores in layers given by 'Metric' distance from the start
+// One flat FIFO bucket per layer, 'm_bucketHeads' is the read position in each of them
+// Buckets that get exhausted are recycled (keeping their capacity) for the layers that come later
+// Multi-source: all the seeds are in layer 0, other positions are layered by the distance to the seed they were reached
+// from ('m_lastSeedID' after 'get_next') ... that is also a Voronoi-style labelling of the area
+template <typename F_Allowed, size_t Dims, typename Metric, typename Layout>
+class _LayeredExplorer : public _GridExplorer<F_Allowed, Dims, Layout> {
+    using _base = _GridExplorer<F_Allowed, Dims, Layout>;
+
+public:
+    using typename _base::Pos_t;
+
+    struct Entry {
+        Pos_t  pos;
+        size_t seedID;
+    };
+
+    std::pmr::vector<Pos_t>                   m_seeds;
+    std::pmr::vector<std::pmr::vector<Entry>> m_buckets;
+    std::pmr::vector<size_t>                  m_bucketHeads;
+    std::pmr::vector<std::pmr::vector<Entry>> m_spareBuckets;
+    size_t                                    m_queuedCount      = 0uz;
+    size_t                                    m_queueIDToUseNext = 0uz;
+    size_t                                    m_lastSeedID       = 0uz;
+
+
+public:
+    _LayeredExplorer(Pos_t startPos, Pos_t areaSzs,
+                     std::pmr::memory_resource *memRes = std::pmr::get_default_resource())
+        : _base(F_Allowed{}, startPos, std::move(areaSzs), Pos_t{}, memRes), m_seeds(memRes), m_buckets(memRes),
+          m_bucketHeads(memRes), m_spareBuckets(memRes) {
+        _seed(std::span(&startPos, 1uz));
+    }
+
+    // F_allowed is a unary functor(lambda) taking std::array<size_t, Dims> const &
+    _LayeredExplorer(F_Allowed &&f, Pos_t startPos, Pos_t areaSzs,
+                     std::pmr::memory_resource *memRes = std::pmr::get_default_resource())
+        : _base(std::forward<F_Allowed>(f), startPos, std::move(areaSzs), Pos_t{}, memRes), m_seeds(memRes),
+          m_buckets(memRes), m_bucketHeads(memRes), m_spareBuckets(memRes) {
+        _seed(std::span(&startPos, 1uz));
+    }
+
+    // F_allowed is a unary functor(lambda) taking std::array<size_t, Dims> const &
+    _LayeredExplorer(F_Allowed &&f, Pos_t startPos, Pos_t areaSzs, Pos_t areaMins,
+                     std::pmr::memory_resource *memRes = std::pmr::get_default_resource())
+        : _base(std::forward<F_Allowed>(f), startPos, std::move(areaSzs), std::move(areaMins), memRes),
+          m_seeds(memRes), m_buckets(memRes), m_bucketHeads(memRes), m_spareBuckets(memRes) {
+        _seed(std::span(&startPos, 1uz));
+    }
+
+    // Multi-source, 'm_startPos' is the first of the seeds
+    _LayeredExplorer(F_Allowed &&f, std::span<Pos_t const> seeds, Pos_t areaSzs,
+                     std::pmr::memory_resource *memRes = std::pmr::get_default_resource())
+        : _base(std::forward<F_Allowed>(f), _ctor_firstSeed(seeds), std::move(areaSzs), Pos_t{}, memRes),
+          m_seeds(memRes), m_buckets(memRes), m_bucketHeads(memRes), m_spareBuckets(memRes) {
+        _seed(seeds);
+    }
+
+    // Multi-source, 'm_startPos' is the first of the seeds
+    _LayeredExplorer(F_Allowed &&f, std::span<Pos_t const> seeds, Pos_t areaSzs, Pos_t areaMins,
+                     std::pmr::memory_resource *memRes = std::pmr::get_default_resource())
+        : _base(std::forward<F_Allowed>(f), _ctor_firstSeed(seeds), std::move(areaSzs), std::move(areaMins), memRes),
+          m_seeds(memRes), m_buckets(memRes), m_bucketHeads(memRes), m_spareBuckets(memRes) {
+        _seed(seeds);
+    }
+
+
+    // Restarts the exploration from 'startPos' (same area, same F_Allowed) without any new allocation
+    // Costs O(positions visited so far), not O(area)
+    void
+    reset(Pos_t startPos) {
+        reset(std::span(&startPos, 1uz));
+    }
+    void
+    reset(std::span<Pos_t const> seeds) {
+        this->_clear_visited();
+        for (size_t layerID = 0uz; layerID < m_buckets.size(); ++layerID) { _recycle_bucket(layerID); }
+        m_buckets.clear();
+        m_bucketHeads.clear();
+        this->m_startPos = _ctor_firstSeed(seeds);
+        _seed(seeds);
     }
 
     bool
@@ -117,35 +474,28 @@ public:
 
     Pos_t
     get_next() {
-        Pos_t res = make_filledPos_size_t();
+        Pos_t res = this->make_filledPos_size_t();
         if (m_queuedCount != 0uz) {
-            res = m_VofQueues[m_queueIDToUseNext].front();
-            m_VofQueues[m_queueIDToUseNext].pop_front();
-
-            // Make sure we create a new queue if we are at the 'end'
-            if (m_queueIDToUseNext == (m_VofQueues.size() - 1)) { m_VofQueues.emplace_back(); }
-
-            for (auto const &oneDir : m_dirChanges) {
-                Pos_t toInsert = res;
-                [&]<size_t... Is>(std::index_sequence<Is...>) { ((toInsert[Is] += oneDir[Is]), ...); }(c_IDs_sequence);
-
-                if (is_inArea(toInsert) && not is_alreadyVisited(toInsert) && m_f_allowed(toInsert)) {
-                    visit_at(toInsert);
-                    size_t queInsertID = 0uz;
-                    for (int i = 0; i < Dims; ++i) {
-                        queInsertID =
-                            std::max(queInsertID, (toInsert[i] > m_startPos[i] ? toInsert[i] - m_startPos[i]
-                                                                               : m_startPos[i] - toInsert[i]));
-                    }
-
-                    m_VofQueues.at(queInsertID).push_back(std::move(toInsert));
+            auto const [pos, seedID] = m_buckets[m_queueIDToUseNext][m_bucketHeads[m_queueIDToUseNext]++];
+            res                      = pos;
+            m_lastSeedID             = seedID;
+
+            for (auto const &oneDir : this->m_dirChanges) {
+                Pos_t toInsert = this->_moved(res, oneDir);
+
+                if (this->is_inArea(toInsert) && not this->is_alreadyVisited(toInsert) && this->m_f_allowed(toInsert)) {
+                    this->visit_at(toInsert);
+                    size_t const queInsertID = Metric::compute(toInsert, m_seeds[seedID]);
+
+                    _bucket_at(queInsertID).push_back({std::move(toInsert), seedID});
                     m_queueIDToUseNext = std::min(m_queueIDToUseNext, queInsertID);
                     m_queuedCount++;
                 }
             }
         }
-        while (m_queueIDToUseNext < m_VofQueues.size() && m_VofQueues[m_queueIDToUseNext].empty()) {
-            m_queueIDToUseNext++;
+        while (m_queueIDToUseNext < m_buckets.size() &&
+               m_bucketHeads[m_queueIDToUseNext] == m_buckets[m_queueIDToUseNext].size()) {
+            _recycle_bucket(m_queueIDToUseNext++);
         }
         m_queuedCount--;
         return res;
@@ -153,24 +503,592 @@ public:
 
 
 private:
-    static size_t
-    _ctor_total_sz(Pos_t const &sizes) {
-        return std::ranges::fold_left(sizes, 1uz, std::multiplies{});
+    std::pmr::vector<Entry> &
+    _bucket_at(size_t layerID) {
+        while (m_buckets.size() <= layerID) {
+            m_buckets.emplace_back();
+            m_bucketHeads.push_back(0uz);
+        }
+        // New and recycled buckets have no storage of their own, they take a spare one if there is any
+        auto &bucket = m_buckets[layerID];
+        if (bucket.capacity() == 0uz && not m_spareBuckets.empty()) {
+            bucket.swap(m_spareBuckets.back());
+            m_spareBuckets.pop_back();
+        }
+        return bucket;
     }
 
-    static Extents
-    _ctor_make_extents(Pos_t const &sizes) {
-        return [&]<size_t... Is>(std::index_sequence<Is...>) { return Extents(sizes[Is]...); }(c_IDs_sequence);
+    void
+    _recycle_bucket(size_t layerID) {
+        auto &bucket           = m_buckets[layerID];
+        m_bucketHeads[layerID] = 0uz;
+        bucket.clear();
+        if (bucket.capacity() != 0uz) { m_spareBuckets.emplace_back().swap(bucket); }
     }
 
-    static constexpr Pos_t
-    make_filledPos_size_t() {
-        return [&]<size_t... Is>(std::index_sequence<Is...>) {
-            return Pos_t{((void)Is, std::numeric_limits<size_t>::max())...};
-        }(std::make_index_sequence<Dims>{});
+    // Duplicate seeds are queued only once, seeds outside of the area are skipped
+    void
+    _seed(std::span<Pos_t const> seeds) {
+        m_seeds.assign(seeds.begin(), seeds.end());
+        m_queuedCount      = 0uz;
+        m_queueIDToUseNext = 0uz;
+        m_lastSeedID       = 0uz;
+        for (size_t seedID = 0uz; seedID < m_seeds.size(); ++seedID) {
+            if (not this->is_inArea(m_seeds[seedID]) || this->is_alreadyVisited(m_seeds[seedID])) { continue; }
+            this->visit_at(m_seeds[seedID]);
+            _bucket_at(0uz).push_back({m_seeds[seedID], seedID});
+            m_queuedCount++;
+        }
+    }
+
+    static Pos_t
+    _ctor_firstSeed(std::span<Pos_t const> seeds) {
+        assert((void("Explorer needs at least one seed"), not seeds.empty()));
+        return seeds.front();
     }
 };
 
+
+// Shared base of the weighted explorers (Dijkstra, AStar)
+// Visited bit means 'settled' (final distance known), 'm_dist' holds the best distance found so far
+template <typename F_Allowed, typename F_Weight, size_t Dims, typename Layout>
+class _WeightedExplorer : public _GridExplorer<F_Allowed, Dims, Layout> {
+    using _base = _GridExplorer<F_Allowed, Dims, Layout>;
+
+public:
+    using typename _base::Pos_t;
+
+    static constexpr size_t c_unreached = std::numeric_limits<size_t>::max();
+
+    std::pmr::vector<size_t> m_dist;
+    std::pmr::vector<size_t> m_touchedCells;
+    F_Weight                 m_f_weight;
+
+
+protected:
+    _WeightedExplorer(F_Allowed &&f, F_Weight &&w, Pos_t startPos, Pos_t areaSzs, Pos_t areaMins,
+                      std::pmr::memory_resource *memRes)
+        : _base(std::forward<F_Allowed>(f), startPos, std::move(areaSzs), std::move(areaMins), memRes),
+          m_dist(this->m_visitedMapping.required_span_size(), c_unreached, memRes), m_touchedCells(memRes),
+          m_f_weight(std::forward<F_Weight>(w)) {}
+
+
+public:
+    // Final for positions already returned from 'get_next', 'c_unreached' for positions not reached (yet)
+    size_t
+    get_distance(Pos_t const &p) const {
+        return m_dist[this->_linearID(p)];
+    }
+
+
+protected:
+    bool
+    _try_improve(Pos_t const &p, size_t dist) {
+        size_t const id = this->_linearID(p);
+        if (dist >= m_dist[id]) { return false; }
+        if (m_dist[id] == c_unreached) { m_touchedCells.push_back(id); }
+        m_dist[id] = dist;
+        return true;
+    }
+
+    bool
+    _is_stale(Pos_t const &p, size_t dist) {
+        return this->is_alreadyVisited(p) || m_dist[this->_linearID(p)] != dist;
+    }
+
+    // Calls 'push(pos, dist)' for every neighbour whose distance got improved
+    template <typename F_Push>
+    void
+    _relax_neighbours(Pos_t const &from, size_t fromDist, F_Push &&push) {
+        for (auto const &oneDir : this->m_dirChanges) {
+            Pos_t const toRelax = this->_moved(from, oneDir);
+            if (not this->is_inArea(toRelax) || this->is_alreadyVisited(toRelax) || not this->m_f_allowed(toRelax)) {
+                continue;
+            }
+            size_t const newDist = fromDist + static_cast<size_t>(m_f_weight(toRelax));
+            if (_try_improve(toRelax, newDist)) { push(toRelax, newDist); }
+        }
+    }
+
+    void
+    _clear_distances() {
+        if (m_touchedCells.size() * 4uz > m_dist.size()) { std::ranges::fill(m_dist, c_unreached); }
+        else {
+            for (auto const cellID : m_touchedCells) { m_dist[cellID] = c_unreached; }
+        }
+        m_touchedCells.clear();
+    }
+};
+} // namespace detail
+
+
+// Explores 'Dims-dimensional' space in Chebyshev-layered fashion (as if by chessboard distance)
+// 'Layout' of the visited map can be any mdspan layout policy (eg. layout_tiled<8> or layout_morton for large areas)
+template <typename F_Allowed, size_t Dims, typename Layout = detail::pf_layout_right>
+requires(Dims > 0) && requires(F_Allowed f, std::array<size_t, Dims> const &item) {
+    { f(item) } -> std::same_as<bool>; // The F_Allowed need to be able to take 'Pos_t const&'
+}
+class Chebyshev : public detail::_LayeredExplorer<F_Allowed, Dims, detail::_ChebyshevDist, Layout> {
+public:
+    using detail::_LayeredExplorer<F_Allowed, Dims, detail::_ChebyshevDist, Layout>::_LayeredExplorer;
+};
+
+// Explores 'Dims-dimensional' space in Manhattan-layered fashion (diamond shaped layers)
+template <typename F_Allowed, size_t Dims, typename Layout = detail::pf_layout_right>
+requires(Dims > 0) && requires(F_Allowed f, std::array<size_t, Dims> const &item) {
+    { f(item) } -> std::same_as<bool>; // The F_Allowed need to be able to take 'Pos_t const&'
+}
+class Manhattan : public detail::_LayeredExplorer<F_Allowed, Dims, detail::_ManhattanDist, Layout> {
+public:
+    using detail::_LayeredExplorer<F_Allowed, Dims, detail::_ManhattanDist, Layout>::_LayeredExplorer;
+};
+
+
+// Explores 'Dims-dimensional' space in the order of (squared) Euclidean distance from the start
+// 'm_queueIDToUseNext' is the squared distance of the position 'get_next' returns next
+template <typename F_Allowed, size_t Dims, typename Layout = detail::pf_layout_right>
+requires(Dims > 0) && requires(F_Allowed f, std::array<size_t, Dims> const &item) {
+    { f(item) } -> std::same_as<bool>; // The F_Allowed need to be able to take 'Pos_t const&'
+}
+class Euclidean : public detail::_GridExplorer<F_Allowed, Dims, Layout> {
+    using _base = detail::_GridExplorer<F_Allowed, Dims, Layout>;
+
+public:
+    using typename _base::Pos_t;
+
+    struct Entry {
+        size_t sqDist;
+        Pos_t  pos;
+    };
+
+    std::pmr::vector<Entry> m_heap;
+    size_t                  m_queueIDToUseNext = 0uz;
+
+
+public:
+    Euclidean(Pos_t startPos, Pos_t areaSzs, std::pmr::memory_resource *memRes = std::pmr::get_default_resource())
+        : _base(F_Allowed{}, startPos, std::move(areaSzs), Pos_t{}, memRes), m_heap(memRes) {
+        _seed(std::move(startPos));
+    }
+
+    // F_allowed is a unary functor(lambda) taking std::array<size_t, Dims> const &
+    Euclidean(F_Allowed &&f, Pos_t startPos, Pos_t areaSzs,
+              std::pmr::memory_resource *memRes = std::pmr::get_default_resource())
+        : _base(std::forward<F_Allowed>(f), startPos, std::move(areaSzs), Pos_t{}, memRes), m_heap(memRes) {
+        _seed(std::move(startPos));
+    }
+
+    // F_allowed is a unary functor(lambda) taking std::array<size_t, Dims> const &
+    Euclidean(F_Allowed &&f, Pos_t startPos, Pos_t areaSzs, Pos_t areaMins,
+              std::pmr::memory_resource *memRes = std::pmr::get_default_resource())
+        : _base(std::forward<F_Allowed>(f), startPos, std::move(areaSzs), std::move(areaMins), memRes),
+          m_heap(memRes) {
+        _seed(std::move(startPos));
+    }
+
+
+    void
+    reset(Pos_t startPos) {
+        this->_clear_visited();
+        m_heap.clear();
+        this->m_startPos = startPos;
+        _seed(std::move(startPos));
+    }
+
+    bool
+    is_atEnd() {
+        return m_heap.empty();
+    }
+
+    Pos_t
+    get_next() {
+        if (m_heap.empty()) { return this->make_filledPos_size_t(); }
+
+        std::ranges::pop_heap(m_heap, std::greater{}, &Entry::sqDist);
+        Pos_t const res = m_heap.back().pos;
+        m_heap.pop_back();
+
+        for (auto const &oneDir : this->m_dirChanges) {
+            Pos_t toInsert = this->_moved(res, oneDir);
+
+            if (this->is_inArea(toInsert) && not this->is_alreadyVisited(toInsert) && this->m_f_allowed(toInsert)) {
+                this->visit_at(toInsert);
+                m_heap.push_back({detail::_EuclideanSqDist::compute(toInsert, this->m_startPos), std::move(toInsert)});
+                std::ranges::push_heap(m_heap, std::greater{}, &Entry::sqDist);
+            }
+        }
+        m_queueIDToUseNext = m_heap.empty() ? std::numeric_limits<size_t>::max() : m_heap.front().sqDist;
+        return res;
+    }
+
+
+private:
+    void
+    _seed(Pos_t &&startPos) {
+        // Start position outside of the area ... nothing to explore
+        if (not this->is_inArea(startPos)) {
+            m_queueIDToUseNext = std::numeric_limits<size_t>::max();
+            return;
+        }
+        this->visit_at(startPos);
+        m_heap.push_back({0uz, std::move(startPos)});
+        m_queueIDToUseNext = 0uz;
+    }
+};
+
+
+// Dijkstra for small integer weights, the priority queue is a ring of 'maxWeight + 1' buckets (Dial's algorithm)
+// F_Weight is a unary functor(lambda) taking std::array<size_t, Dims> const & ... the cost of stepping onto it
+// Positions come out of 'get_next' in the order of their (final) distance from the start
+// 'm_queueIDToUseNext' is the distance of the position 'get_next' returns next
+template <typename F_Allowed, typename F_Weight, size_t Dims, typename Layout = detail::pf_layout_right>
+requires(Dims > 0) && requires(F_Allowed f, F_Weight w, std::array<size_t, Dims> const &item) {
+    { f(item) } -> std::same_as<bool>;
+    { w(item) } -> std::convertible_to<size_t>;
+}
+class Dijkstra : public detail::_WeightedExplorer<F_Allowed, F_Weight, Dims, Layout> {
+    using _base = detail::_WeightedExplorer<F_Allowed, F_Weight, Dims, Layout>;
+
+public:
+    using typename _base::Pos_t;
+
+    struct Entry {
+        size_t dist;
+        Pos_t  pos;
+    };
+
+    std::pmr::vector<std::pmr::vector<Entry>> m_ring;
+    size_t                                    m_queuedCount      = 0uz; // Including the stale entries
+    size_t                                    m_queueIDToUseNext = 0uz;
+
+
+public:
+    Dijkstra(F_Allowed &&f, F_Weight &&w, Pos_t startPos, Pos_t areaSzs, size_t maxWeight,
+             std::pmr::memory_resource *memRes = std::pmr::get_default_resource())
+        : _base(std::forward<F_Allowed>(f), std::forward<F_Weight>(w), startPos, std::move(areaSzs), Pos_t{}, memRes),
+          m_ring(maxWeight + 1uz, memRes) {
+        _seed(std::move(startPos));
+    }
+
+    Dijkstra(F_Allowed &&f, F_Weight &&w, Pos_t startPos, Pos_t areaSzs, Pos_t areaMins, size_t maxWeight,
+             std::pmr::memory_resource *memRes = std::pmr::get_default_resource())
+        : _base(std::forward<F_Allowed>(f), std::forward<F_Weight>(w), startPos, std::move(areaSzs),
+                std::move(areaMins), memRes),
+          m_ring(maxWeight + 1uz, memRes) {
+        _seed(std::move(startPos));
+    }
+
+
+    void
+    reset(Pos_t startPos) {
+        this->_clear_visited();
+        this->_clear_distances();
+        for (auto &bucket : m_ring) { bucket.clear(); }
+        m_queuedCount    = 0uz;
+        this->m_startPos = startPos;
+        _seed(std::move(startPos));
+    }
+
+    bool
+    is_atEnd() {
+        return m_queuedCount == 0uz;
+    }
+
+    Pos_t
+    get_next() {
+        if (m_queuedCount == 0uz) { return this->make_filledPos_size_t(); }
+
+        auto       &bucket = m_ring[m_queueIDToUseNext % m_ring.size()];
+        Entry const cur    = bucket.back();
+        bucket.pop_back();
+        m_queuedCount--;
+
+        this->visit_at(cur.pos);
+        this->_relax_neighbours(cur.pos, cur.dist, [&](Pos_t const &pos, size_t dist) {
+            assert((void("Dijkstra: F_Weight returned more than 'maxWeight'"), dist - cur.dist < m_ring.size()));
+            m_ring[dist % m_ring.size()].push_back({dist, pos});
+            m_queuedCount++;
+        });
+        _advance();
+        return cur.pos;
+    }
+
+
+private:
+    // Moves to the next non-stale entry (if any)
+    void
+    _advance() {
+        while (m_queuedCount != 0uz) {
+            auto &bucket = m_ring[m_queueIDToUseNext % m_ring.size()];
+            if (bucket.empty()) { m_queueIDToUseNext++; }
+            else if (this->_is_stale(bucket.back().pos, bucket.back().dist)) {
+                bucket.pop_back();
+                m_queuedCount--;
+            }
+            else { return; }
+        }
+        m_queueIDToUseNext = std::numeric_limits<size_t>::max();
+    }
+
+    void
+    _seed(Pos_t &&startPos) {
+        // Start position outside of the area ... nothing to explore
+        if (not this->is_inArea(startPos)) {
+            m_queueIDToUseNext = std::numeric_limits<size_t>::max();
+            return;
+        }
+        this->_try_improve(startPos, 0uz);
+        m_ring.front().push_back({0uz, std::move(startPos)});
+        m_queuedCount      = 1uz;
+        m_queueIDToUseNext = 0uz;
+    }
+};
+
+
+// A* with pluggable heuristic, the priority queue is a binary heap ordered by 'distance + heuristic'
+// F_Weight is a unary functor(lambda) taking std::array<size_t, Dims> const & ... the cost of stepping onto it
+// F_Heuristic is a unary functor(lambda) taking std::array<size_t, Dims> const & ... must not overestimate (and should
+// be consistent) for the distances to be final when the position comes out of 'get_next'
+// 'm_queueIDToUseNext' is the 'distance + heuristic' of the position 'get_next' returns next
+template <typename F_Allowed, typename F_Weight, typename F_Heuristic, size_t Dims,
+          typename Layout = detail::pf_layout_right>
+requires(Dims > 0) && requires(F_Allowed f, F_Weight w, F_Heuristic h, std::array<size_t, Dims> const &item) {
+    { f(item) } -> std::same_as<bool>;
+    { w(item) } -> std::convertible_to<size_t>;
+    { h(item) } -> std::convertible_to<size_t>;
+}
+class AStar : public detail::_WeightedExplorer<F_Allowed, F_Weight, Dims, Layout> {
+    using _base = detail::_WeightedExplorer<F_Allowed, F_Weight, Dims, Layout>;
+
+public:
+    using typename _base::Pos_t;
+
+    struct Entry {
+        size_t estimate;
+        size_t dist;
+        Pos_t  pos;
+    };
+
+    F_Heuristic             m_f_heuristic;
+    std::pmr::vector<Entry> m_heap; // Including the stale entries
+    size_t                  m_queueIDToUseNext = 0uz;
+
+
+public:
+    AStar(F_Allowed &&f, F_Weight &&w, F_Heuristic &&h, Pos_t startPos, Pos_t areaSzs,
+          std::pmr::memory_resource *memRes = std::pmr::get_default_resource())
+        : _base(std::forward<F_Allowed>(f), std::forward<F_Weight>(w), startPos, std::move(areaSzs), Pos_t{}, memRes),
+          m_f_heuristic(std::forward<F_Heuristic>(h)), m_heap(memRes) {
+        _seed(std::move(startPos));
+    }
+
+    AStar(F_Allowed &&f, F_Weight &&w, F_Heuristic &&h, Pos_t startPos, Pos_t areaSzs, Pos_t areaMins,
+          std::pmr::memory_resource *memRes = std::pmr::get_default_resource())
+        : _base(std::forward<F_Allowed>(f), std::forward<F_Weight>(w), startPos, std::move(areaSzs),
+                std::move(areaMins), memRes),
+          m_f_heuristic(std::forward<F_Heuristic>(h)), m_heap(memRes) {
+        _seed(std::move(startPos));
+    }
+
+
+    void
+    reset(Pos_t startPos) {
+        this->_clear_visited();
+        this->_clear_distances();
+        m_heap.clear();
+        this->m_startPos = startPos;
+        _seed(std::move(startPos));
+    }
+
+    bool
+    is_atEnd() {
+        return m_heap.empty();
+    }
+
+    Pos_t
+    get_next() {
+        if (m_heap.empty()) { return this->make_filledPos_size_t(); }
+
+        std::ranges::pop_heap(m_heap, _lowerPriority);
+        Entry const cur = m_heap.back();
+        m_heap.pop_back();
+
+        this->visit_at(cur.pos);
+        this->_relax_neighbours(cur.pos, cur.dist, [&](Pos_t const &pos, size_t dist) {
+            m_heap.push_back({dist + static_cast<size_t>(m_f_heuristic(pos)), dist, pos});
+            std::ranges::push_heap(m_heap, _lowerPriority);
+        });
+        _advance();
+        return cur.pos;
+    }
+
+
+private:
+    // Lower estimate first, on ties prefer the one further from the start (closer to the target)
+    static constexpr bool
+    _lowerPriority(Entry const &a, Entry const &b) {
+        return a.estimate != b.estimate ? a.estimate > b.estimate : a.dist < b.dist;
+    }
+
+    // Drops the stale entries from the top of the heap
+    void
+    _advance() {
+        while (not m_heap.empty() && this->_is_stale(m_heap.front().pos, m_heap.front().dist)) {
+            std::ranges::pop_heap(m_heap, _lowerPriority);
+            m_heap.pop_back();
+        }
+        m_queueIDToUseNext = m_heap.empty() ? std::numeric_limits<size_t>::max() : m_heap.front().estimate;
+    }
+
+    void
+    _seed(Pos_t &&startPos) {
+        // Start position outside of the area ... nothing to explore
+        if (not this->is_inArea(startPos)) {
+            m_queueIDToUseNext = std::numeric_limits<size_t>::max();
+            return;
+        }
+        this->_try_improve(startPos, 0uz);
+        size_t const estimate = static_cast<size_t>(m_f_heuristic(startPos));
+        m_heap.push_back({estimate, 0uz, std::move(startPos)});
+        m_queueIDToUseNext = estimate;
+    }
+};
+
+
+// Lazy stream of the positions 'get_next' would return (the explorer must outlive the generator)
+// Can stop early, the explorer does not get advanced further than one position beyond what was consumed
+template <typename EXPLR>
+requires requires(EXPLR &explr) {
+    { explr.is_atEnd() } -> std::same_as<bool>;
+    { explr.get_next() } -> std::same_as<typename EXPLR::Pos_t>;
+}
+coroutines::generator<typename EXPLR::Pos_t const &>
+as_generator(EXPLR &explr) {
+    while (not explr.is_atEnd()) { co_yield explr.get_next(); }
+}
+
+// Overload: Coroutine frame allocated from 'alloc'
+template <typename Alloc, typename EXPLR>
+requires requires(EXPLR &explr) {
+    { explr.is_atEnd() } -> std::same_as<bool>;
+    { explr.get_next() } -> std::same_as<typename EXPLR::Pos_t>;
+}
+coroutines::generator<typename EXPLR::Pos_t const &>
+as_generator(std::allocator_arg_t, Alloc const &alloc, EXPLR &explr) {
+    while (not explr.is_atEnd()) { co_yield explr.get_next(); }
+}
+
+
+// Multi-source breadth first distance transform (geodesic distance over the 2*Dims axis neighbours)
+// Layer synchronous, each layer is split among 'threadCount' threads, visited map is a bitset with atomic test-and-set
+// F_Allowed is called concurrently from multiple threads, it must be thread safe
+// Results are in row-major order of 'areaSzs'. Positions reachable from more seeds at the same distance get labelled
+// by whichever of them got there first
+struct DistanceTransform {
+    static constexpr size_t c_unreached = std::numeric_limits<size_t>::max();
+
+    std::vector<size_t> distances;
+    std::vector<size_t> seedIDs;
+};
+
+template <size_t Dims, typename F_Allowed>
+requires(Dims > 0) && requires(F_Allowed const f, std::array<size_t, Dims> const &item) {
+    { f(item) } -> std::same_as<bool>;
+}
+DistanceTransform
+compute_distanceTransform(F_Allowed const &f, std::span<std::array<size_t, Dims> const> seeds,
+                          std::array<size_t, Dims> const &areaSzs,
+                          size_t threadCount = std::max(1u, std::thread::hardware_concurrency())) {
+    using Pos_t = std::array<size_t, Dims>;
+
+    size_t const totalSz = std::ranges::fold_left(areaSzs, 1uz, std::multiplies{});
+    auto const   linearID = [&](Pos_t const &p) {
+        size_t res = 0uz;
+        for (size_t i = 0; i < Dims; ++i) { res = res * areaSzs[i] + p[i]; }
+        return res;
+    };
+
+    DistanceTransform res{std::vector<size_t>(totalSz, DistanceTransform::c_unreached),
+                          std::vector<size_t>(totalSz, DistanceTransform::c_unreached)};
+    std::vector<std::atomic<std::uint64_t>> visitedBits((totalSz + 63uz) / 64uz);
+
+    // Returns true if 'id' was not visited before
+    auto const test_and_set = [&](size_t id) {
+        std::uint64_t const mask = std::uint64_t{1} << (id & 63uz);
+        return (visitedBits[id >> 6].fetch_or(mask, std::memory_order_relaxed) & mask) == 0uz;
+    };
+
+    std::vector<Pos_t> frontier;
+    for (size_t seedID = 0uz; seedID < seeds.size(); ++seedID) {
+        size_t const id = linearID(seeds[seedID]);
+        if (not test_and_set(id)) { continue; }
+        res.distances[id] = 0uz;
+        res.seedIDs[id]   = seedID;
+        frontier.push_back(seeds[seedID]);
+    }
+
+    threadCount = std::max(threadCount, 1uz);
+    std::vector<std::vector<Pos_t>> nextPerThread(threadCount);
+    size_t                          layer = 0uz;
+
+    // Distance and seedID of a position are written only by the thread that won its test-and-set
+    // The barrier between the layers makes them visible to everyone else
+    auto const expand = [&](size_t thrID) {
+        size_t const chunkSz = (frontier.size() + threadCount - 1) / threadCount;
+        size_t const from    = std::min(frontier.size(), thrID * chunkSz);
+        size_t const to      = std::min(frontier.size(), from + chunkSz);
+
+        auto &next = nextPerThread[thrID];
+        next.clear();
+        for (size_t i = from; i < to; ++i) {
+            size_t const fromSeed = res.seedIDs[linearID(frontier[i])];
+            for (size_t dim = 0; dim < Dims; ++dim) {
+                for (size_t const step : {std::numeric_limits<size_t>::max(), 1uz}) {
+                    Pos_t toInsert = frontier[i];
+                    toInsert[dim] += step;
+                    if (toInsert[dim] >= areaSzs[dim] || not f(toInsert)) { continue; }
+
+                    size_t const id = linearID(toInsert);
+                    if (not test_and_set(id)) { continue; }
+                    res.distances[id] = layer + 1;
+                    res.seedIDs[id]   = fromSeed;
+                    next.push_back(toInsert);
+                }
+            }
+        }
+    };
+    auto const merge = [&]() {
+        frontier.clear();
+        for (auto const &next : nextPerThread) { frontier.insert(frontier.end(), next.begin(), next.end()); }
+        layer++;
+    };
+
+    if (threadCount == 1uz) {
+        while (not frontier.empty()) {
+            expand(0uz);
+            merge();
+        }
+        return res;
+    }
+
+    std::barrier sync(static_cast<std::ptrdiff_t>(threadCount));
+    auto const   worker = [&](size_t thrID) {
+        while (not frontier.empty()) {
+            expand(thrID);
+            sync.arrive_and_wait();
+            if (thrID == 0uz) { merge(); }
+            sync.arrive_and_wait();
+        }
+    };
+    {
+        std::vector<std::jthread> helpers;
+        for (size_t thrID = 1uz; thrID < threadCount; ++thrID) { helpers.emplace_back(worker, thrID); }
+        worker(0uz);
+    }
+    return res;
+}
+
+
 // Deduction guides
 template <size_t N>
 Chebyshev(std::array<size_t, N> const &, std::array<size_t, N> const &)
@@ -183,4 +1101,130 @@ template <typename F, size_t N>
 Chebyshev(F &&, std::array<size_t, N> const &, std::array<size_t, N> const &, std::array<size_t, N> const &)
     -> Chebyshev<std::remove_cvref_t<F>, N>;
 
+template <size_t N>
+Chebyshev(std::array<size_t, N> const &, std::array<size_t, N> const &, std::pmr::memory_resource *)
+    -> Chebyshev<std::remove_cvref_t<decltype([](auto const &item) { return true; })>, N>;
+
+template <typename F, size_t N>
+Chebyshev(F &&, std::array<size_t, N> const &, std::array<size_t, N> const &, std::pmr::memory_resource *)
+    -> Chebyshev<std::remove_cvref_t<F>, N>;
+
+template <typename F, size_t N>
+Chebyshev(F &&, std::array<size_t, N> const &, std::array<size_t, N> const &, std::array<size_t, N> const &,
+          std::pmr::memory_resource *) -> Chebyshev<std::remove_cvref_t<F>, N>;
+
+template <typename F, size_t N>
+Chebyshev(F &&, std::vector<std::array<size_t, N>> const &, std::array<size_t, N> const &)
+    -> Chebyshev<std::remove_cvref_t<F>, N>;
+
+template <typename F, size_t N>
+Chebyshev(F &&, std::vector<std::array<size_t, N>> const &, std::array<size_t, N> const &,
+          std::array<size_t, N> const &) -> Chebyshev<std::remove_cvref_t<F>, N>;
+
+template <typename F, size_t N>
+Chebyshev(F &&, std::vector<std::array<size_t, N>> const &, std::array<size_t, N> const &, std::pmr::memory_resource *)
+    -> Chebyshev<std::remove_cvref_t<F>, N>;
+
+template <typename F, size_t N>
+Chebyshev(F &&, std::vector<std::array<size_t, N>> const &, std::array<size_t, N> const &,
+          std::array<size_t, N> const &, std::pmr::memory_resource *) -> Chebyshev<std::remove_cvref_t<F>, N>;
+
+
+template <size_t N>
+Manhattan(std::array<size_t, N> const &, std::array<size_t, N> const &)
+    -> Manhattan<std::remove_cvref_t<decltype([](auto const &item) { return true; })>, N>;
+
+template <typename F, size_t N>
+Manhattan(F &&, std::array<size_t, N> const &, std::array<size_t, N> const &) -> Manhattan<std::remove_cvref_t<F>, N>;
+
+template <typename F, size_t N>
+Manhattan(F &&, std::array<size_t, N> const &, std::array<size_t, N> const &, std::array<size_t, N> const &)
+    -> Manhattan<std::remove_cvref_t<F>, N>;
+
+template <size_t N>
+Manhattan(std::array<size_t, N> const &, std::array<size_t, N> const &, std::pmr::memory_resource *)
+    -> Manhattan<std::remove_cvref_t<decltype([](auto const &item) { return true; })>, N>;
+
+template <typename F, size_t N>
+Manhattan(F &&, std::array<size_t, N> const &, std::array<size_t, N> const &, std::pmr::memory_resource *)
+    -> Manhattan<std::remove_cvref_t<F>, N>;
+
+template <typename F, size_t N>
+Manhattan(F &&, std::array<size_t, N> const &, std::array<size_t, N> const &, std::array<size_t, N> const &,
+          std::pmr::memory_resource *) -> Manhattan<std::remove_cvref_t<F>, N>;
+
+template <typename F, size_t N>
+Manhattan(F &&, std::vector<std::array<size_t, N>> const &, std::array<size_t, N> const &)
+    -> Manhattan<std::remove_cvref_t<F>, N>;
+
+template <typename F, size_t N>
+Manhattan(F &&, std::vector<std::array<size_t, N>> const &, std::array<size_t, N> const &,
+          std::array<size_t, N> const &) -> Manhattan<std::remove_cvref_t<F>, N>;
+
+template <typename F, size_t N>
+Manhattan(F &&, std::vector<std::array<size_t, N>> const &, std::array<size_t, N> const &, std::pmr::memory_resource *)
+    -> Manhattan<std::remove_cvref_t<F>, N>;
+
+template <typename F, size_t N>
+Manhattan(F &&, std::vector<std::array<size_t, N>> const &, std::array<size_t, N> const &,
+          std::array<size_t, N> const &, std::pmr::memory_resource *) -> Manhattan<std::remove_cvref_t<F>, N>;
+
+
+template <size_t N>
+Euclidean(std::array<size_t, N> const &, std::array<size_t, N> const &)
+    -> Euclidean<std::remove_cvref_t<decltype([](auto const &item) { return true; })>, N>;
+
+template <typename F, size_t N>
+Euclidean(F &&, std::array<size_t, N> const &, std::array<size_t, N> const &) -> Euclidean<std::remove_cvref_t<F>, N>;
+
+template <typename F, size_t N>
+Euclidean(F &&, std::array<size_t, N> const &, std::array<size_t, N> const &, std::array<size_t, N> const &)
+    -> Euclidean<std::remove_cvref_t<F>, N>;
+
+template <size_t N>
+Euclidean(std::array<size_t, N> const &, std::array<size_t, N> const &, std::pmr::memory_resource *)
+    -> Euclidean<std::remove_cvref_t<decltype([](auto const &item) { return true; })>, N>;
+
+template <typename F, size_t N>
+Euclidean(F &&, std::array<size_t, N> const &, std::array<size_t, N> const &, std::pmr::memory_resource *)
+    -> Euclidean<std::remove_cvref_t<F>, N>;
+
+template <typename F, size_t N>
+Euclidean(F &&, std::array<size_t, N> const &, std::array<size_t, N> const &, std::array<size_t, N> const &,
+          std::pmr::memory_resource *) -> Euclidean<std::remove_cvref_t<F>, N>;
+
+
+template <typename F, typename W, size_t N>
+Dijkstra(F &&, W &&, std::array<size_t, N> const &, std::array<size_t, N> const &, size_t)
+    -> Dijkstra<std::remove_cvref_t<F>, std::remove_cvref_t<W>, N>;
+
+template <typename F, typename W, size_t N>
+Dijkstra(F &&, W &&, std::array<size_t, N> const &, std::array<size_t, N> const &, size_t, std::pmr::memory_resource *)
+    -> Dijkstra<std::remove_cvref_t<F>, std::remove_cvref_t<W>, N>;
+
+template <typename F, typename W, size_t N>
+Dijkstra(F &&, W &&, std::array<size_t, N> const &, std::array<size_t, N> const &, std::array<size_t, N> const &,
+         size_t) -> Dijkstra<std::remove_cvref_t<F>, std::remove_cvref_t<W>, N>;
+
+template <typename F, typename W, size_t N>
+Dijkstra(F &&, W &&, std::array<size_t, N> const &, std::array<size_t, N> const &, std::array<size_t, N> const &,
+         size_t, std::pmr::memory_resource *) -> Dijkstra<std::remove_cvref_t<F>, std::remove_cvref_t<W>, N>;
+
+
+template <typename F, typename W, typename H, size_t N>
+AStar(F &&, W &&, H &&, std::array<size_t, N> const &, std::array<size_t, N> const &)
+    -> AStar<std::remove_cvref_t<F>, std::remove_cvref_t<W>, std::remove_cvref_t<H>, N>;
+
+template <typename F, typename W, typename H, size_t N>
+AStar(F &&, W &&, H &&, std::array<size_t, N> const &, std::array<size_t, N> const &, std::pmr::memory_resource *)
+    -> AStar<std::remove_cvref_t<F>, std::remove_cvref_t<W>, std::remove_cvref_t<H>, N>;
+
+template <typename F, typename W, typename H, size_t N>
+AStar(F &&, W &&, H &&, std::array<size_t, N> const &, std::array<size_t, N> const &, std::array<size_t, N> const &)
+    -> AStar<std::remove_cvref_t<F>, std::remove_cvref_t<W>, std::remove_cvref_t<H>, N>;
+
+template <typename F, typename W, typename H, size_t N>
+AStar(F &&, W &&, H &&, std::array<size_t, N> const &, std::array<size_t, N> const &, std::array<size_t, N> const &,
+      std::pmr::memory_resource *) -> AStar<std::remove_cvref_t<F>, std::remove_cvref_t<W>, std::remove_cvref_t<H>, N>;
+
 } // namespace incom::standard::explorers
@@ -1,7 +1,17 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <execution>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
+#include <incstd/core/coroutines.hpp>
+#include <incstd/polyfills/mdspan.hpp>
 #include <more_concepts/more_concepts.hpp>
 
 namespace incom::standard::matrix {
@@ -50,4 +60,629 @@ matrixRotateRight(T &VofVlike) {
     return;
 }
 
-} // namespace incom::standard::matrix
\ No newline at end of file
+
+// #######################################
+// ### PACKED BIT MATRICES   #############
+// #######################################
+
+// 64x64 bit matrix, bit 'c' of row 'r' is the cell in row 'r' and column 'c'
+// Smaller square matrices occupy the top left corner (the rest must be zero), 'sz' is their side length
+using BitMatrix64 = std::array<std::uint64_t, 64>;
+
+namespace detail {
+constexpr std::uint64_t
+_reverseBits(std::uint64_t word) noexcept {
+    word = ((word >> 1) & 0x5555555555555555ull) | ((word & 0x5555555555555555ull) << 1);
+    word = ((word >> 2) & 0x3333333333333333ull) | ((word & 0x3333333333333333ull) << 2);
+    word = ((word >> 4) & 0x0F0F0F0F0F0F0F0Full) | ((word & 0x0F0F0F0F0F0F0F0Full) << 4);
+    return std::byteswap(word);
+}
+
+// Low half of every group of 2 * blockSz bits, indexed by log2(blockSz)
+constexpr inline std::array<std::uint64_t, 6> c_transposeMasks{0x5555555555555555ull, 0x3333333333333333ull,
+                                                               0x0F0F0F0F0F0F0F0Full, 0x00FF00FF00FF00FFull,
+                                                               0x0000FFFF0000FFFFull, 0x00000000FFFFFFFFull};
+
+// Bits of one byte spread into 8 bools
+constexpr inline std::array<std::array<bool, 8>, 256> c_byteToBools = [] {
+    std::array<std::array<bool, 8>, 256> res{};
+    for (size_t byte = 0; byte < 256; ++byte) {
+        for (size_t bit = 0; bit < 8; ++bit) { res[byte][bit] = (byte >> bit) & 1; }
+    }
+    return res;
+}();
+
+// Up to 8 bools into the low bits of a byte, with little endian it is one multiplication (every bool lands on its own
+// bit of the top byte and no two partial products overlap)
+constexpr std::uint64_t
+_pack8(bool const *src, size_t const count) noexcept {
+    std::array<bool, 8> chunk{};
+    for (size_t i = 0; i < count; ++i) { chunk[i] = src[i]; }
+    if constexpr (std::endian::native == std::endian::little && sizeof(bool) == 1) {
+        return (std::bit_cast<std::uint64_t>(chunk) * 0x0102040810204080ull) >> 56;
+    }
+    else {
+        std::uint64_t res = 0;
+        for (size_t bit = 0; bit < 8; ++bit) { res |= static_cast<std::uint64_t>(chunk[bit]) << bit; }
+        return res;
+    }
+}
+
+// Square bool matrices up to 8x8 fit into a single word, row 'r' in byte 'r' (same bit order as BitMatrix64)
+template <size_t N>
+requires(N > 0 && N <= 8)
+constexpr std::uint64_t
+_pack_word(std::array<std::array<bool, N>, N> const &mtrx) noexcept {
+    std::uint64_t res = 0;
+    for (size_t r = 0; r < N; ++r) { res |= _pack8(mtrx[r].data(), N) << (8 * r); }
+    return res;
+}
+
+template <size_t N>
+requires(N > 0 && N <= 8)
+constexpr std::array<std::array<bool, N>, N>
+_unpack_word(std::uint64_t const word, bool const upsideDown) noexcept {
+    std::array<std::array<bool, N>, N> res;
+    for (size_t r = 0; r < N; ++r) {
+        auto const &bools = c_byteToBools[(word >> (8 * r)) & 0xFF];
+        auto       &line  = res[upsideDown ? N - 1 - r : r];
+        for (size_t c = 0; c < N; ++c) { line[c] = bools[c]; }
+    }
+    return res;
+}
+
+// The 3 delta swap rounds of 'bitMatrixTranspose' done on all rows at once
+constexpr std::uint64_t
+_transpose_word(std::uint64_t word) noexcept {
+    std::uint64_t diff;
+    diff  = (word ^ (word >> 7)) & 0x00AA00AA00AA00AAull;
+    word ^= diff ^ (diff << 7);
+    diff  = (word ^ (word >> 14)) & 0x0000CCCC0000CCCCull;
+    word ^= diff ^ (diff << 14);
+    diff  = (word ^ (word >> 28)) & 0x00000000F0F0F0F0ull;
+    word ^= diff ^ (diff << 28);
+    return word;
+}
+
+// Reversing the bits of every byte leaves the low '8 - sz' bits of each byte empty, so nothing leaks between rows
+constexpr std::uint64_t
+_flipHorizontal_word(std::uint64_t const word, size_t const sz) noexcept {
+    return std::byteswap(_reverseBits(word)) >> (8 - sz);
+}
+
+template <typename T>
+constexpr inline bool _is_smallBoolSquare = false;
+template <size_t N>
+requires(N > 0 && N <= 64)
+constexpr inline bool _is_smallBoolSquare<std::array<std::array<bool, N>, N>> = true;
+} // namespace detail
+
+// Transposes in place with delta swaps, each round swaps the off diagonal blocks of half the previous size
+// Only the smallest power of 2 block covering 'sz' is touched (8x8 takes 3 rounds over 8 rows, 64x64 6 over 64)
+constexpr void
+bitMatrixTranspose(BitMatrix64 &rows, size_t const sz = 64uz) noexcept {
+    size_t const coverSz = std::bit_ceil(std::max(sz, 2uz));
+    for (size_t blockSz = coverSz / 2; blockSz != 0; blockSz >>= 1) {
+        std::uint64_t const mask = detail::c_transposeMasks[std::countr_zero(blockSz)];
+        for (size_t r = 0; r < coverSz; r = ((r | blockSz) + 1) & ~blockSz) {
+            std::uint64_t const diff  = ((rows[r] >> blockSz) ^ rows[r | blockSz]) & mask;
+            rows[r]                  ^= diff << blockSz;
+            rows[r | blockSz]        ^= diff;
+        }
+    }
+}
+
+// Upside down
+constexpr void
+bitMatrixFlipVertical(BitMatrix64 &rows, size_t const sz = 64uz) noexcept {
+    std::ranges::reverse(rows.begin(), rows.begin() + sz);
+}
+
+// Left to right
+constexpr void
+bitMatrixFlipHorizontal(BitMatrix64 &rows, size_t const sz = 64uz) noexcept {
+    for (size_t r = 0; r < sz; ++r) { rows[r] = detail::_reverseBits(rows[r]) >> (64 - sz); }
+}
+
+// Same direction as 'matrixRotateLeft'
+constexpr void
+bitMatrixRotateLeft(BitMatrix64 &rows, size_t const sz = 64uz) noexcept {
+    bitMatrixTranspose(rows, sz);
+    bitMatrixFlipVertical(rows, sz);
+}
+
+// Same direction as 'matrixRotateRight'
+constexpr void
+bitMatrixRotateRight(BitMatrix64 &rows, size_t const sz = 64uz) noexcept {
+    bitMatrixTranspose(rows, sz);
+    bitMatrixFlipHorizontal(rows, sz);
+}
+
+template <size_t N>
+requires(N > 0 && N <= 64)
+constexpr BitMatrix64
+bitMatrix_pack(std::array<std::array<bool, N>, N> const &mtrx) noexcept {
+    BitMatrix64 res{};
+    for (size_t r = 0; r < N; ++r) {
+        for (size_t c = 0; c < N; c += 8) { res[r] |= detail::_pack8(mtrx[r].data() + c, std::min(8uz, N - c)) << c; }
+    }
+    return res;
+}
+
+template <size_t N>
+requires(N > 0 && N <= 64)
+constexpr std::array<std::array<bool, N>, N>
+bitMatrix_unpack(BitMatrix64 const &rows, bool const upsideDown = false) noexcept {
+    std::array<std::array<bool, N>, N> res;
+    for (size_t r = 0; r < N; ++r) {
+        auto &line = res[upsideDown ? N - 1 - r : r];
+        for (size_t c = 0; c < N; c += 8) {
+            auto const &bools = detail::c_byteToBools[(rows[r] >> c) & 0xFF];
+            for (size_t i = 0; i < std::min(8uz, N - c); ++i) { line[c + i] = bools[i]; }
+        }
+    }
+    return res;
+}
+
+
+// Overloads: Square bool matrices up to 64x64 go through the packed bit matrix kernels
+template <size_t N>
+requires(N > 0 && N <= 64)
+constexpr void
+matrixRotateLeft(std::array<std::array<bool, N>, N> &mtrx) noexcept {
+    if constexpr (N <= 8) {
+        std::uint64_t const word = detail::_transpose_word(detail::_pack_word(mtrx));
+        mtrx                     = detail::_unpack_word<N>(word, true);
+    }
+    else {
+        BitMatrix64 packed = bitMatrix_pack(mtrx);
+        bitMatrixRotateLeft(packed, N);
+        mtrx = bitMatrix_unpack<N>(packed);
+    }
+}
+
+template <size_t N>
+requires(N > 0 && N <= 64)
+constexpr void
+matrixRotateRight(std::array<std::array<bool, N>, N> &mtrx) noexcept {
+    if constexpr (N <= 8) {
+        std::uint64_t const word = detail::_transpose_word(detail::_pack_word(mtrx));
+        mtrx                     = detail::_unpack_word<N>(detail::_flipHorizontal_word(word, N), false);
+    }
+    else {
+        BitMatrix64 packed = bitMatrix_pack(mtrx);
+        bitMatrixRotateRight(packed, N);
+        mtrx = bitMatrix_unpack<N>(packed);
+    }
+}
+
+template <size_t N>
+requires(N > 0 && N <= 64)
+constexpr void
+matrixTranspose(std::array<std::array<bool, N>, N> &mtrx) noexcept {
+    if constexpr (N <= 8) {
+        std::uint64_t const word = detail::_transpose_word(detail::_pack_word(mtrx));
+        mtrx                     = detail::_unpack_word<N>(word, false);
+    }
+    else {
+        BitMatrix64 packed = bitMatrix_pack(mtrx);
+        bitMatrixTranspose(packed, N);
+        mtrx = bitMatrix_unpack<N>(packed);
+    }
+}
+
+
+// All 8 rotations and reflections (the dihedral group) of a square matrix, duplicates included
+// Order: 0, 1, 2, 3 times rotated left, then vertically flipped (after the 3rd rotation) and again 0, 1, 2, 3 times
+// rotated left. Square bool matrices up to 64x64 are packed once and processed as bit matrices
+template <typename T>
+requires more_concepts::random_access_container<T> && more_concepts::random_access_container<typename T::value_type> &&
+         std::swappable<typename T::value_type::value_type>
+std::array<T, 8>
+compute_dihedralVariants(T const &VofVlike) {
+    std::array<T, 8> res;
+    if constexpr (detail::_is_smallBoolSquare<T>) {
+        constexpr size_t c_sz = std::tuple_size_v<T>;
+
+        // Every variant is the original or its transposition, possibly flipped horizontally, read out possibly upside
+        // down ... so just one transposition and two horizontal flips in total
+        auto fill = [&](auto const &orig, auto const &trans, auto const &origFlipped, auto const &transFlipped,
+                        auto const &unpack) {
+            res[0] = unpack(orig, false);
+            res[1] = unpack(trans, true);
+            res[2] = unpack(origFlipped, true);
+            res[3] = unpack(transFlipped, false);
+            res[4] = unpack(transFlipped, true);
+            res[5] = unpack(origFlipped, false);
+            res[6] = unpack(trans, false);
+            res[7] = unpack(orig, true);
+        };
+
+        if constexpr (c_sz <= 8) {
+            std::uint64_t const orig  = detail::_pack_word(VofVlike);
+            std::uint64_t const trans = detail::_transpose_word(orig);
+            fill(orig, trans, detail::_flipHorizontal_word(orig, c_sz), detail::_flipHorizontal_word(trans, c_sz),
+                 [](std::uint64_t const word, bool upsideDown) {
+                     return detail::_unpack_word<c_sz>(word, upsideDown);
+                 });
+        }
+        else {
+            BitMatrix64 const orig  = bitMatrix_pack(VofVlike);
+            BitMatrix64       trans = orig;
+            bitMatrixTranspose(trans, c_sz);
+            BitMatrix64 origFlipped  = orig;
+            BitMatrix64 transFlipped = trans;
+            bitMatrixFlipHorizontal(origFlipped, c_sz);
+            bitMatrixFlipHorizontal(transFlipped, c_sz);
+            fill(orig, trans, origFlipped, transFlipped, [](BitMatrix64 const &rows, bool upsideDown) {
+                return bitMatrix_unpack<c_sz>(rows, upsideDown);
+            });
+        }
+    }
+    else {
+        T cur = VofVlike;
+        for (size_t i = 0; i < 8; ++i) {
+            if (i == 4) { std::ranges::reverse(cur); }
+            else if (i != 0) { matrixRotateLeft(cur); }
+            res[i] = cur;
+        }
+    }
+    return res;
+}
+
+
+// #######################################
+// ### MDSPAN MATRICES   #################
+// #######################################
+
+namespace detail {
+#if defined(INCSTD_MDSPAN_UNDER_KOKKOS)
+template <class IndexType, size_t Rank>
+using pf_dextents = Kokkos::dextents<IndexType, Rank>;
+
+template <class ElementType, class Extents>
+using pf_mdspan = Kokkos::mdspan<ElementType, Extents>;
+
+template <class ElementType, class Extents, class Accessor>
+using pf_mdspan_right = Kokkos::mdspan<ElementType, Extents, Kokkos::layout_right, Accessor>;
+
+using pf_layout_right = Kokkos::layout_right;
+#else
+template <class IndexType, size_t Rank>
+using pf_dextents = std::dextents<IndexType, Rank>;
+
+template <class ElementType, class Extents>
+using pf_mdspan = std::mdspan<ElementType, Extents>;
+
+template <class ElementType, class Extents, class Accessor>
+using pf_mdspan_right = std::mdspan<ElementType, Extents, std::layout_right, Accessor>;
+
+using pf_layout_right = std::layout_right;
+#endif
+
+template <typename MDS>
+concept _is_matrixSpan = requires {
+    typename MDS::mapping_type;
+    typename MDS::element_type;
+} && (MDS::rank() == 2) && std::is_trivially_copyable_v<typename MDS::element_type>;
+
+template <typename MDS>
+concept _is_mutMatrixSpan = _is_matrixSpan<MDS> && (not std::is_const_v<typename MDS::element_type>);
+
+// Rows are contiguous and follow each other, the same memory can be viewed with different extents
+template <typename MDS>
+concept _is_rowMajorMatrixSpan =
+    _is_mutMatrixSpan<MDS> && std::is_same_v<typename MDS::layout_type, pf_layout_right> &&
+    std::is_same_v<typename MDS::data_handle_type, typename MDS::element_type *>;
+
+// Work is done in square tiles of roughly this many bytes, source and destination tile then both fit into L1
+constexpr inline size_t c_matrixTileBytes = 4096uz;
+
+// Largest power of 2 side for which a tile of 'T' fits into 'c_matrixTileBytes'
+template <typename T>
+constexpr inline size_t c_matrixTileSide =
+    1uz << ((std::bit_width(std::max(c_matrixTileBytes / sizeof(T), 1uz)) - 1) / 2);
+
+// Work is split across the pool only when every thread gets at least this many elements
+constexpr inline size_t c_parMatrixMinChunkSz = 64uz * 1024uz;
+
+enum class _Remap { transpose, rotateLeft, rotateRight, flipVertical, flipHorizontal };
+
+// Where the element at 'row', 'col' of a 'rows' x 'cols' source ends up
+template <_Remap KIND>
+constexpr std::pair<size_t, size_t>
+_remapped(size_t const row, size_t const col, size_t const rows, size_t const cols) noexcept {
+    if constexpr (KIND == _Remap::transpose) { return {col, row}; }
+    else if constexpr (KIND == _Remap::rotateLeft) { return {cols - 1 - col, row}; }
+    else if constexpr (KIND == _Remap::rotateRight) { return {col, rows - 1 - row}; }
+    else if constexpr (KIND == _Remap::flipVertical) { return {rows - 1 - row, col}; }
+    else { return {row, cols - 1 - col}; }
+}
+
+template <_Remap KIND>
+constexpr inline bool _keepsShape = KIND == _Remap::flipVertical || KIND == _Remap::flipHorizontal;
+
+constexpr size_t
+_chunkCount_forPool(coroutines::ThreadPool const *pool, size_t const elemCount, size_t const maxChunks) noexcept {
+    if (pool == nullptr) { return 1uz; }
+    return std::max(1uz, std::min({pool->thread_count() * 4, elemCount / c_parMatrixMinChunkSz, maxChunks}));
+}
+
+// Out of place, source is read one tile at a time so the (scattered) writes of one tile stay within a few cache lines
+template <_Remap KIND>
+void
+_remap_tileRows(auto const &src, auto const &dst, size_t const rowBeg, size_t const rowEnd) {
+    constexpr size_t c_tile = c_matrixTileSide<typename std::remove_cvref_t<decltype(src)>::element_type>;
+    size_t const     rows   = src.extent(0);
+    size_t const     cols   = src.extent(1);
+
+    for (size_t r0 = rowBeg; r0 < rowEnd; r0 += c_tile) {
+        size_t const rEnd = std::min(rowEnd, r0 + c_tile);
+        for (size_t c0 = 0; c0 < cols; c0 += c_tile) {
+            size_t const cEnd = std::min(cols, c0 + c_tile);
+            for (size_t r = r0; r < rEnd; ++r) {
+                for (size_t c = c0; c < cEnd; ++c) {
+                    auto const [dr, dc] = _remapped<KIND>(r, c, rows, cols);
+                    dst[dr, dc]         = src[r, c];
+                }
+            }
+        }
+    }
+}
+
+template <_Remap KIND>
+void
+_remap(auto const &src, auto const &dst, coroutines::ThreadPool *pool) {
+    constexpr size_t c_tile = c_matrixTileSide<typename std::remove_cvref_t<decltype(src)>::element_type>;
+    size_t const     rows   = src.extent(0);
+    size_t const     cols   = src.extent(1);
+    if constexpr (_keepsShape<KIND>) { assert(dst.extent(0) == rows && dst.extent(1) == cols); }
+    else { assert(dst.extent(0) == cols && dst.extent(1) == rows); }
+
+    size_t const tileRows   = (rows + c_tile - 1) / c_tile;
+    size_t const chunkCount = _chunkCount_forPool(pool, rows * cols, tileRows);
+    if (chunkCount < 2) { return _remap_tileRows<KIND>(src, dst, 0, rows); }
+
+    // Chunks are bands of whole tile rows
+    coroutines::parallel_for(*pool, chunkCount, [&](size_t chunkID) {
+        _remap_tileRows<KIND>(src, dst, std::min(rows, tileRows * chunkID / chunkCount * c_tile),
+                              std::min(rows, tileRows * (chunkID + 1) / chunkCount * c_tile));
+    });
+}
+
+// In place square transposition, tile (I, J) is swapped with the transposition of tile (J, I)
+// Tile row 'I' has 'tileRows - I' tiles to do, so the chunks take every 'chunkCount'-th tile row to balance that out
+void
+_transpose_square(auto const &mtrx, coroutines::ThreadPool *pool) {
+    constexpr size_t c_tile   = c_matrixTileSide<typename std::remove_cvref_t<decltype(mtrx)>::element_type>;
+    size_t const     sz       = mtrx.extent(0);
+    size_t const     tileRows = (sz + c_tile - 1) / c_tile;
+
+    auto tileRowsFrom = [&](size_t const firstTileRow, size_t const step) {
+        for (size_t r0 = firstTileRow * c_tile; r0 < sz; r0 += step * c_tile) {
+            size_t const rEnd = std::min(sz, r0 + c_tile);
+            for (size_t c0 = r0; c0 < sz; c0 += c_tile) {
+                size_t const cEnd = std::min(sz, c0 + c_tile);
+                for (size_t r = r0; r < rEnd; ++r) {
+                    for (size_t c = std::max(c0, r + 1); c < cEnd; ++c) { std::swap(mtrx[r, c], mtrx[c, r]); }
+                }
+            }
+        }
+    };
+
+    size_t const chunkCount = _chunkCount_forPool(pool, sz * sz / 2, tileRows);
+    if (chunkCount < 2) { return tileRowsFrom(0, 1); }
+    coroutines::parallel_for(*pool, chunkCount, [&](size_t chunkID) { tileRowsFrom(chunkID, chunkCount); });
+}
+
+// In place flips of row major matrices, whole rows are swapped or reversed
+template <_Remap KIND>
+requires(_keepsShape<KIND>)
+void
+_flip_rowMajor(auto const &mtrx, coroutines::ThreadPool *pool) {
+    size_t const rows     = mtrx.extent(0);
+    size_t const cols     = mtrx.extent(1);
+    size_t const rowCount = KIND == _Remap::flipVertical ? rows / 2 : rows;
+    if (cols == 0) { return; }
+
+    auto doRows = [&](size_t const rowBeg, size_t const rowEnd) {
+        for (size_t r = rowBeg; r < rowEnd; ++r) {
+            auto *const line = &mtrx[r, 0];
+            if constexpr (KIND == _Remap::flipVertical) { std::swap_ranges(line, line + cols, &mtrx[rows - 1 - r, 0]); }
+            else { std::reverse(line, line + cols); }
+        }
+    };
+
+    size_t const chunkCount = _chunkCount_forPool(pool, rowCount * cols, rowCount);
+    if (chunkCount < 2) { return doRows(0, rowCount); }
+    coroutines::parallel_for(*pool, chunkCount, [&](size_t chunkID) {
+        doRows(rowCount * chunkID / chunkCount, rowCount * (chunkID + 1) / chunkCount);
+    });
+}
+
+// In place, returns the result viewed with its own extents (rows and columns swap unless 'KIND' keeps the shape)
+// Square matrices are transposed tile by tile and then flipped, others are copied aside and remapped back
+template <_Remap KIND, typename MDS>
+auto
+_remap_inPlace(MDS const &mtrx, coroutines::ThreadPool *pool) {
+    using elem_t    = typename MDS::element_type;
+    using extents_t = pf_dextents<typename MDS::index_type, 2>;
+    using result_t  = pf_mdspan_right<elem_t, extents_t, typename MDS::accessor_type>;
+
+    size_t const rows = mtrx.extent(0);
+    size_t const cols = mtrx.extent(1);
+    if constexpr (_keepsShape<KIND>) {
+        _flip_rowMajor<KIND>(mtrx, pool);
+        return result_t(mtrx.data_handle(), extents_t(rows, cols));
+    }
+    else {
+        result_t const res(mtrx.data_handle(), extents_t(cols, rows));
+        if (rows == cols) {
+            _transpose_square(mtrx, pool);
+            if constexpr (KIND == _Remap::rotateLeft) { _flip_rowMajor<_Remap::flipVertical>(res, pool); }
+            else if constexpr (KIND == _Remap::rotateRight) { _flip_rowMajor<_Remap::flipHorizontal>(res, pool); }
+        }
+        else {
+            std::vector<elem_t> const scratch(mtrx.data_handle(), mtrx.data_handle() + rows * cols);
+            _remap<KIND>(pf_mdspan<elem_t const, extents_t>(scratch.data(), extents_t(rows, cols)), res, pool);
+        }
+        return res;
+    }
+}
+} // namespace detail
+
+
+// Overloads for 2D mdspans of trivially copyable elements (rectangular allowed), meant for large dense matrices
+// Out of place versions take 'src' and 'dst' of any layout, 'dst' must have the extents of the result
+// In place versions take row major (layout_right) mdspans and return the result viewed with its own extents, for
+// non-square matrices that means a temporary copy of the whole matrix
+// With an execution policy other than 'std::execution::seq' large matrices are processed on the shared pool
+template <typename SRC, typename DST>
+requires detail::_is_matrixSpan<SRC> && detail::_is_mutMatrixSpan<DST> &&
+         std::is_same_v<std::remove_const_t<typename SRC::element_type>, typename DST::element_type>
+void
+matrixTranspose(SRC const &src, DST const &dst) {
+    detail::_remap<detail::_Remap::transpose>(src, dst, nullptr);
+}
+template <typename EP, typename SRC, typename DST>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>> && detail::_is_matrixSpan<SRC> &&
+         detail::_is_mutMatrixSpan<DST> &&
+         std::is_same_v<std::remove_const_t<typename SRC::element_type>, typename DST::element_type>
+void
+matrixTranspose(EP &&, SRC const &src, DST const &dst) {
+    detail::_remap<detail::_Remap::transpose>(src, dst, coroutines::pool_forPolicy<EP>());
+}
+
+template <typename SRC, typename DST>
+requires detail::_is_matrixSpan<SRC> && detail::_is_mutMatrixSpan<DST> &&
+         std::is_same_v<std::remove_const_t<typename SRC::element_type>, typename DST::element_type>
+void
+matrixRotateLeft(SRC const &src, DST const &dst) {
+    detail::_remap<detail::_Remap::rotateLeft>(src, dst, nullptr);
+}
+template <typename EP, typename SRC, typename DST>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>> && detail::_is_matrixSpan<SRC> &&
+         detail::_is_mutMatrixSpan<DST> &&
+         std::is_same_v<std::remove_const_t<typename SRC::element_type>, typename DST::element_type>
+void
+matrixRotateLeft(EP &&, SRC const &src, DST const &dst) {
+    detail::_remap<detail::_Remap::rotateLeft>(src, dst, coroutines::pool_forPolicy<EP>());
+}
+
+template <typename SRC, typename DST>
+requires detail::_is_matrixSpan<SRC> && detail::_is_mutMatrixSpan<DST> &&
+         std::is_same_v<std::remove_const_t<typename SRC::element_type>, typename DST::element_type>
+void
+matrixRotateRight(SRC const &src, DST const &dst) {
+    detail::_remap<detail::_Remap::rotateRight>(src, dst, nullptr);
+}
+template <typename EP, typename SRC, typename DST>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>> && detail::_is_matrixSpan<SRC> &&
+         detail::_is_mutMatrixSpan<DST> &&
+         std::is_same_v<std::remove_const_t<typename SRC::element_type>, typename DST::element_type>
+void
+matrixRotateRight(EP &&, SRC const &src, DST const &dst) {
+    detail::_remap<detail::_Remap::rotateRight>(src, dst, coroutines::pool_forPolicy<EP>());
+}
+
+// Upside down
+template <typename SRC, typename DST>
+requires detail::_is_matrixSpan<SRC> && detail::_is_mutMatrixSpan<DST> &&
+         std::is_same_v<std::remove_const_t<typename SRC::element_type>, typename DST::element_type>
+void
+matrixFlipVertical(SRC const &src, DST const &dst) {
+    detail::_remap<detail::_Remap::flipVertical>(src, dst, nullptr);
+}
+template <typename EP, typename SRC, typename DST>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>> && detail::_is_matrixSpan<SRC> &&
+         detail::_is_mutMatrixSpan<DST> &&
+         std::is_same_v<std::remove_const_t<typename SRC::element_type>, typename DST::element_type>
+void
+matrixFlipVertical(EP &&, SRC const &src, DST const &dst) {
+    detail::_remap<detail::_Remap::flipVertical>(src, dst, coroutines::pool_forPolicy<EP>());
+}
+
+// Left to right
+template <typename SRC, typename DST>
+requires detail::_is_matrixSpan<SRC> && detail::_is_mutMatrixSpan<DST> &&
+         std::is_same_v<std::remove_const_t<typename SRC::element_type>, typename DST::element_type>
+void
+matrixFlipHorizontal(SRC const &src, DST const &dst) {
+    detail::_remap<detail::_Remap::flipHorizontal>(src, dst, nullptr);
+}
+template <typename EP, typename SRC, typename DST>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>> && detail::_is_matrixSpan<SRC> &&
+         detail::_is_mutMatrixSpan<DST> &&
+         std::is_same_v<std::remove_const_t<typename SRC::element_type>, typename DST::element_type>
+void
+matrixFlipHorizontal(EP &&, SRC const &src, DST const &dst) {
+    detail::_remap<detail::_Remap::flipHorizontal>(src, dst, coroutines::pool_forPolicy<EP>());
+}
+
+
+template <typename MDS>
+requires detail::_is_rowMajorMatrixSpan<MDS>
+auto
+matrixTranspose(MDS const &mtrx) {
+    return detail::_remap_inPlace<detail::_Remap::transpose>(mtrx, nullptr);
+}
+template <typename EP, typename MDS>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>> && detail::_is_rowMajorMatrixSpan<MDS>
+auto
+matrixTranspose(EP &&, MDS const &mtrx) {
+    return detail::_remap_inPlace<detail::_Remap::transpose>(mtrx, coroutines::pool_forPolicy<EP>());
+}
+
+template <typename MDS>
+requires detail::_is_rowMajorMatrixSpan<MDS>
+auto
+matrixRotateLeft(MDS const &mtrx) {
+    return detail::_remap_inPlace<detail::_Remap::rotateLeft>(mtrx, nullptr);
+}
+template <typename EP, typename MDS>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>> && detail::_is_rowMajorMatrixSpan<MDS>
+auto
+matrixRotateLeft(EP &&, MDS const &mtrx) {
+    return detail::_remap_inPlace<detail::_Remap::rotateLeft>(mtrx, coroutines::pool_forPolicy<EP>());
+}
+
+template <typename MDS>
+requires detail::_is_rowMajorMatrixSpan<MDS>
+auto
+matrixRotateRight(MDS const &mtrx) {
+    return detail::_remap_inPlace<detail::_Remap::rotateRight>(mtrx, nullptr);
+}
+template <typename EP, typename MDS>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>> && detail::_is_rowMajorMatrixSpan<MDS>
+auto
+matrixRotateRight(EP &&, MDS const &mtrx) {
+    return detail::_remap_inPlace<detail::_Remap::rotateRight>(mtrx, coroutines::pool_forPolicy<EP>());
+}
+
+template <typename MDS>
+requires detail::_is_rowMajorMatrixSpan<MDS>
+auto
+matrixFlipVertical(MDS const &mtrx) {
+    return detail::_remap_inPlace<detail::_Remap::flipVertical>(mtrx, nullptr);
+}
+template <typename EP, typename MDS>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>> && detail::_is_rowMajorMatrixSpan<MDS>
+auto
+matrixFlipVertical(EP &&, MDS const &mtrx) {
+    return detail::_remap_inPlace<detail::_Remap::flipVertical>(mtrx, coroutines::pool_forPolicy<EP>());
+}
+
+template <typename MDS>
+requires detail::_is_rowMajorMatrixSpan<MDS>
+auto
+matrixFlipHorizontal(MDS const &mtrx) {
+    return detail::_remap_inPlace<detail::_Remap::flipHorizontal>(mtrx, nullptr);
+}
+template <typename EP, typename MDS>
+requires std::is_execution_policy_v<std::remove_cvref_t<EP>> && detail::_is_rowMajorMatrixSpan<MDS>
+auto
+matrixFlipHorizontal(EP &&, MDS const &mtrx) {
+    return detail::_remap_inPlace<detail::_Remap::flipHorizontal>(mtrx, coroutines::pool_forPolicy<EP>());
+}
+
+} // namespace incom::standard::matrix
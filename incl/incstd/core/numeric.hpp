@@ -1,44 +1,328 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <functional>
+#include <limits>
 #include <ranges>
+#include <string>
 #include <type_traits>
+#include <utility>
 
 
 namespace incom::standard::numeric {
 using namespace incom::standard;
 
+namespace detail {
+constexpr inline std::array<std::uint64_t, 20> c_powersOf10 = [] {
+    std::array<std::uint64_t, 20> res{};
+    res[0] = 1;
+    for (size_t i = 1; i < res.size(); ++i) { res[i] = res[i - 1] * 10; }
+    return res;
+}();
+
+// "00" "01" ... "99" back to back, integers are written two digits at a time
+constexpr inline std::array<char, 200> c_digitPairs = [] {
+    std::array<char, 200> res{};
+    for (size_t i = 0; i < 100; ++i) {
+        res[2 * i]     = static_cast<char>('0' + i / 10);
+        res[2 * i + 1] = static_cast<char>('0' + i % 10);
+    }
+    return res;
+}();
+
+// Magnitude of the value, works for the most negative value of signed types as well
+template <typename T>
+constexpr std::conditional_t<(sizeof(T) <= sizeof(std::uint32_t)), std::uint32_t, std::uint64_t>
+_magnitude(T const value) noexcept {
+    using U = std::conditional_t<(sizeof(T) <= sizeof(std::uint32_t)), std::uint32_t, std::uint64_t>;
+    if constexpr (std::is_signed_v<T>) { return value < 0 ? U{0} - static_cast<U>(value) : static_cast<U>(value); }
+    else { return static_cast<U>(value); }
+}
+
+// bit_width * log10(2) (as 1233 / 4096) undershoots by at most one, the table lookup fixes that up
+// 'value | 1' maps 0 onto 1 digit and can never cross a power of 10
+constexpr int
+_numOfDigits(std::uint64_t const value) noexcept {
+    std::uint64_t const nonZero = value | 1;
+    int const           approx  = (std::bit_width(nonZero) * 1233) >> 12;
+    return approx + (nonZero >= c_powersOf10[approx]);
+}
+} // namespace detail
+
+// Number of decimal digits (the minus sign doesn't count), no floating point involved
+template <typename T>
+requires std::is_integral_v<T> && (sizeof(T) <= sizeof(std::uint64_t))
+constexpr int
+get_numOfDigits(T const &integralNumber) noexcept {
+    return detail::_numOfDigits(detail::_magnitude(integralNumber));
+}
+
+// Buffer size always sufficient for 'write_integral' of T (including the minus sign)
 template <typename T>
 requires std::is_integral_v<T>
-int
-get_numOfDigits(T const &integralNumber) {
-    if constexpr (std::is_unsigned_v<T>) { return integralNumber == 0 ? 1 : std::trunc(log10(integralNumber)) + 1; }
-    else { return integralNumber == 0 ? 1 : std::trunc(log10(std::abs(integralNumber))) + 1; }
+constexpr inline size_t c_maxIntegralChars = std::numeric_limits<T>::digits10 + 1 + (std::is_signed_v<T> ? 1 : 0);
+
+// Writes the decimal representation straight into 'dest' (no terminating zero), returns one past the last character
+// 'dest' must have space for at least 'c_maxIntegralChars<T>' characters
+template <typename T>
+requires std::is_integral_v<T> && (sizeof(T) <= sizeof(std::uint64_t))
+constexpr char *
+write_integral(char *dest, T const integralNumber) noexcept {
+    if constexpr (std::is_signed_v<T>) {
+        if (integralNumber < 0) { *dest++ = '-'; }
+    }
+
+    auto        mag = detail::_magnitude(integralNumber);
+    char *const end = dest + detail::_numOfDigits(mag);
+    char       *cur = end;
+    while (mag >= 100) {
+        auto const pairID  = (mag % 100) * 2;
+        mag               /= 100;
+        *--cur             = detail::c_digitPairs[pairID + 1];
+        *--cur             = detail::c_digitPairs[pairID];
+    }
+    if (mag >= 10) {
+        *--cur = detail::c_digitPairs[mag * 2 + 1];
+        *--cur = detail::c_digitPairs[mag * 2];
+    }
+    else { *--cur = static_cast<char>('0' + mag); }
+    return end;
 }
 
+// Appends the decimal representation to 'dest' without any temporary string, returns 'dest' for chaining
+template <typename T>
+requires std::is_integral_v<T> && (sizeof(T) <= sizeof(std::uint64_t))
+constexpr std::string &
+append_integral(std::string &dest, T const integralNumber) {
+    std::array<char, c_maxIntegralChars<T>> buf{};
+    return dest.append(buf.data(), write_integral(buf.data(), integralNumber));
+}
+
+
+namespace detail {
+// Contiguous ranges are digested in blocks small enough to be read twice from L1
+constexpr inline size_t c_statsBlockSz   = 1024uz;
+constexpr inline size_t c_statsLaneCount = 8uz;
+} // namespace detail
+
+// Single pass, numerically stable running statistics (Welford, higher moments per Terriberry / Pebay)
+// Two accumulators can be merged (Chan et al.), so a large buffer can be split between threads and the partial results
+// combined at the end. Contiguous ranges go through a block update that vectorizes (independent lanes per block, the
+// block is then merged in as a whole)
+template <bool higherMoments = false>
+class StreamingStats {
+private:
+    size_t _m_count = 0;
+    double _m_mean  = 0.0;
+    double _m_M2    = 0.0; // Sums of powers of differences from the mean
+    double _m_M3    = 0.0;
+    double _m_M4    = 0.0;
+    double _m_min   = std::numeric_limits<double>::infinity();
+    double _m_max   = -std::numeric_limits<double>::infinity();
+
+public:
+    constexpr StreamingStats() = default;
+
+    template <typename T>
+    requires std::is_arithmetic_v<std::ranges::range_value_t<T>>
+    constexpr explicit StreamingStats(T &&range) {
+        push_range(std::forward<T>(range));
+    }
+
+    constexpr void
+    push(double const val) noexcept {
+        double const prevCount = static_cast<double>(_m_count++);
+        double const count     = prevCount + 1.0;
+        double const delta     = val - _m_mean;
+        double const delta_n   = delta / count;
+        double const term      = delta * delta_n * prevCount;
+
+        _m_mean += delta_n;
+        if constexpr (higherMoments) {
+            _m_M4 += term * delta_n * delta_n * (count * count - 3.0 * count + 3.0) + 6.0 * delta_n * delta_n * _m_M2 -
+                     4.0 * delta_n * _m_M3;
+            _m_M3 += term * delta_n * (count - 2.0) - 3.0 * delta_n * _m_M2;
+        }
+        _m_M2 += term;
+        _m_min = std::min(_m_min, val);
+        _m_max = std::max(_m_max, val);
+    }
+
+    template <typename T>
+    requires std::is_arithmetic_v<std::ranges::range_value_t<T>>
+    constexpr void
+    push_range(T &&range) {
+        // Not through 'const &' ... some views (ie. 'filter_view') can only be iterated as non-const
+        if constexpr (std::ranges::contiguous_range<T> && std::ranges::sized_range<T>) {
+            if !consteval {
+                auto const *const data = std::ranges::data(range);
+                size_t const      sz   = std::ranges::size(range);
+                for (size_t from = 0; from < sz; from += detail::c_statsBlockSz) {
+                    merge(_from_block(data + from, std::min(detail::c_statsBlockSz, sz - from)));
+                }
+                return;
+            }
+        }
+        for (auto &&item : range) { push(static_cast<double>(item)); }
+    }
+
+    constexpr void
+    merge(StreamingStats const &other) noexcept {
+        if (other._m_count == 0) { return; }
+        if (_m_count == 0) {
+            *this = other;
+            return;
+        }
+
+        double const countA = static_cast<double>(_m_count);
+        double const countB = static_cast<double>(other._m_count);
+        double const count  = countA + countB;
+        double const delta  = other._m_mean - _m_mean;
+        double const delta2 = delta * delta;
+
+        if constexpr (higherMoments) {
+            _m_M4 += other._m_M4 +
+                     delta2 * delta2 * countA * countB * (countA * countA - countA * countB + countB * countB) /
+                         (count * count * count) +
+                     6.0 * delta2 * (countA * countA * other._m_M2 + countB * countB * _m_M2) / (count * count) +
+                     4.0 * delta * (countA * other._m_M3 - countB * _m_M3) / count;
+            _m_M3 += other._m_M3 + delta2 * delta * countA * countB * (countA - countB) / (count * count) +
+                     3.0 * delta * (countA * other._m_M2 - countB * _m_M2) / count;
+        }
+        _m_M2    += other._m_M2 + delta2 * countA * countB / count;
+        _m_mean  += delta * countB / count;
+        _m_count += other._m_count;
+        _m_min    = std::min(_m_min, other._m_min);
+        _m_max    = std::max(_m_max, other._m_max);
+    }
+
+    [[nodiscard]] constexpr size_t
+    count() const noexcept {
+        return _m_count;
+    }
+    [[nodiscard]] constexpr double
+    mean() const noexcept {
+        return _m_count == 0 ? std::numeric_limits<double>::quiet_NaN() : _m_mean;
+    }
+    // Population variance (divides by count), same as 'compute_variance'
+    [[nodiscard]] constexpr double
+    variance() const noexcept {
+        return _m_count == 0 ? std::numeric_limits<double>::quiet_NaN() : _m_M2 / static_cast<double>(_m_count);
+    }
+    // Sample variance (divides by count - 1)
+    [[nodiscard]] constexpr double
+    sample_variance() const noexcept {
+        return _m_count < 2 ? std::numeric_limits<double>::quiet_NaN() : _m_M2 / static_cast<double>(_m_count - 1);
+    }
+    [[nodiscard]] double
+    stdDeviation() const noexcept {
+        return std::sqrt(variance());
+    }
+    [[nodiscard]] constexpr double
+    minimum() const noexcept {
+        return _m_min;
+    }
+    [[nodiscard]] constexpr double
+    maximum() const noexcept {
+        return _m_max;
+    }
+
+    [[nodiscard]] double
+    skewness() const noexcept
+    requires higherMoments
+    {
+        return std::sqrt(static_cast<double>(_m_count)) * _m_M3 / std::pow(_m_M2, 1.5);
+    }
+    // Excess kurtosis (0 for the normal distribution)
+    [[nodiscard]] constexpr double
+    kurtosis() const noexcept
+    requires higherMoments
+    {
+        return static_cast<double>(_m_count) * _m_M4 / (_m_M2 * _m_M2) - 3.0;
+    }
+
+private:
+    // Two passes over one block (it is in cache for the second one), each pass with independent lanes
+    template <typename T>
+    static StreamingStats
+    _from_block(T const *data, size_t const sz) noexcept {
+        constexpr size_t c_laneCount = detail::c_statsLaneCount;
+
+        std::array<double, c_laneCount> sums{};
+        std::array<double, c_laneCount> mins;
+        std::array<double, c_laneCount> maxs;
+        mins.fill(std::numeric_limits<double>::infinity());
+        maxs.fill(-std::numeric_limits<double>::infinity());
+
+        size_t const fullSz = sz - sz % c_laneCount;
+        for (size_t i = 0; i < fullSz; i += c_laneCount) {
+            for (size_t lane = 0; lane < c_laneCount; ++lane) {
+                double const val  = static_cast<double>(data[i + lane]);
+                sums[lane]       += val;
+                mins[lane]        = std::min(mins[lane], val);
+                maxs[lane]        = std::max(maxs[lane], val);
+            }
+        }
+        for (size_t i = fullSz; i < sz; ++i) {
+            double const val  = static_cast<double>(data[i]);
+            sums[0]          += val;
+            mins[0]           = std::min(mins[0], val);
+            maxs[0]           = std::max(maxs[0], val);
+        }
+
+        StreamingStats res;
+        res._m_count = sz;
+        res._m_mean  = std::ranges::fold_left(sums, 0.0, std::plus{}) / static_cast<double>(sz);
+        res._m_min   = std::ranges::min(mins);
+        res._m_max   = std::ranges::max(maxs);
+
+        // Sums of the differences themselves compensate for the rounding error of the mean (corrected two-pass)
+        std::array<double, c_laneCount> d1s{};
+        std::array<double, c_laneCount> d2s{};
+        std::array<double, c_laneCount> d3s{};
+        std::array<double, c_laneCount> d4s{};
+        auto add_diffs = [&](size_t const lane, double const val) {
+            double const diff  = val - res._m_mean;
+            double const diff2 = diff * diff;
+            d1s[lane]         += diff;
+            d2s[lane]         += diff2;
+            if constexpr (higherMoments) {
+                d3s[lane] += diff2 * diff;
+                d4s[lane] += diff2 * diff2;
+            }
+        };
+        for (size_t i = 0; i < fullSz; i += c_laneCount) {
+            for (size_t lane = 0; lane < c_laneCount; ++lane) { add_diffs(lane, static_cast<double>(data[i + lane])); }
+        }
+        for (size_t i = fullSz; i < sz; ++i) { add_diffs(0, static_cast<double>(data[i])); }
+
+        double const d1 = std::ranges::fold_left(d1s, 0.0, std::plus{});
+        res._m_M2       = std::ranges::fold_left(d2s, 0.0, std::plus{}) - d1 * d1 / static_cast<double>(sz);
+        if constexpr (higherMoments) {
+            res._m_M3 = std::ranges::fold_left(d3s, 0.0, std::plus{});
+            res._m_M4 = std::ranges::fold_left(d4s, 0.0, std::plus{});
+        }
+        return res;
+    }
+};
+
+
+// Population variance in one pass (through 'StreamingStats'), NaN for an empty range
 template <typename T>
 requires std::is_arithmetic_v<std::ranges::range_value_t<T>>
-auto
-compute_variance(T &range) {
-    using v_t    = std::ranges::range_value_t<T>;
-    v_t    sum   = 0;
-    size_t count = 0;
-
-    for (auto const &item : range) {
-        sum += item;
-        count++;
-    }
-    double const avg = static_cast<double>(sum) / count;
-    return (static_cast<double>(std::ranges::fold_left(
-                range, 0.0, [&](double accu, auto const &item) { return accu + std::pow((item - avg), 2); })) /
-            count);
+double
+compute_variance(T &&range) {
+    return StreamingStats<>(std::forward<T>(range)).variance();
 }
 
 template <typename T>
 requires std::is_arithmetic_v<std::ranges::range_value_t<T>>
-auto
+double
 compute_stdDeviation(T &&range) {
     return (std::sqrt(compute_variance(std::forward<T>(range))));
 }
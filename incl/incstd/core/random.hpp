@@ -1,7 +1,13 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <span>
 
 #if defined(_MSC_VER) && ! defined(__clang__)
 #include <intrin.h>
@@ -9,6 +15,83 @@
 
 namespace incom::standard::random {
 
+namespace detail {
+[[nodiscard]] constexpr std::uint64_t
+_multiplyHigh64(std::uint64_t lhs, std::uint64_t rhs) noexcept {
+#if defined(_MSC_VER) && ! defined(__clang__)
+    if !consteval { return __umulh(lhs, rhs); }
+    std::uint64_t const lhsLo = lhs & 0xFFFFFFFFull, lhsHi = lhs >> 32;
+    std::uint64_t const rhsLo = rhs & 0xFFFFFFFFull, rhsHi = rhs >> 32;
+    std::uint64_t const mid   = lhsHi * rhsLo + ((lhsLo * rhsLo) >> 32);
+    return lhsHi * rhsHi + (mid >> 32) + (((mid & 0xFFFFFFFFull) + lhsLo * rhsHi) >> 32);
+#else
+    return static_cast<std::uint64_t>((static_cast<unsigned __int128>(lhs) * rhs) >> 64);
+#endif
+}
+
+// Unbiased integer in [0, maxInclusive] (Lemire's multiply and reject), 'nextWord' supplies uniform 64bit words
+template <typename F>
+[[nodiscard]] constexpr std::size_t
+_bounded(F &&nextWord, std::size_t maxInclusive) noexcept {
+    if (maxInclusive == std::numeric_limits<std::size_t>::max()) { return static_cast<std::size_t>(nextWord()); }
+
+    auto const bound     = static_cast<std::uint64_t>(maxInclusive) + 1ull;
+    auto const threshold = (0ull - bound) % bound;
+
+    for (;;) {
+        auto const randomWord = nextWord();
+        if (randomWord * bound >= threshold) { return static_cast<std::size_t>(_multiplyHigh64(randomWord, bound)); }
+    }
+}
+
+[[nodiscard]] constexpr std::uint64_t
+_splitmix64_mix(std::uint64_t z) noexcept {
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// Top 53 bits into [0, 1)
+[[nodiscard]] constexpr double
+_to_unitDouble(std::uint64_t word) noexcept {
+    return static_cast<double>(word >> 11) * 0x1.0p-53;
+}
+
+// Chunks of words are generated in place and bounded while still in L1, only the (rare) rejected ones are drawn again
+// one by one
+constexpr inline size_t c_fillChunkSz = 256uz;
+
+template <typename GEN>
+constexpr void
+_fill_bounded(GEN &gen, std::span<std::uint64_t> out, std::uint64_t maxInclusive) noexcept {
+    if (maxInclusive == std::numeric_limits<std::uint64_t>::max()) { return gen.fill_u64(out); }
+
+    auto const bound     = maxInclusive + 1ull;
+    auto const threshold = (0ull - bound) % bound;
+    for (size_t done = 0; done < out.size(); done += c_fillChunkSz) {
+        auto const chunk = out.subspan(done, std::min(c_fillChunkSz, out.size() - done));
+        gen.fill_u64(chunk);
+        for (auto &word : chunk) {
+            while (word * bound < threshold) { word = gen.nextRandomWord(); }
+            word = _multiplyHigh64(word, bound);
+        }
+    }
+}
+
+// Goes through a small buffer so that the conversion loop stays separate from (and as vectorizable as) 'fill_u64'
+template <typename GEN>
+constexpr void
+_fill_uniformDouble(GEN &gen, std::span<double> out) noexcept {
+    std::array<std::uint64_t, c_fillChunkSz> buf;
+    for (size_t done = 0; done < out.size(); done += buf.size()) {
+        size_t const chunkSz = std::min(buf.size(), out.size() - done);
+        gen.fill_u64(std::span(buf.data(), chunkSz));
+        for (size_t i = 0; i < chunkSz; ++i) { out[done + i] = _to_unitDouble(buf[i]); }
+    }
+}
+} // namespace detail
+
+
 struct FastPseudoRandom {
     std::uint64_t m_state = 0x9e3779b97f4a7c15ull;
 
@@ -23,45 +106,374 @@ struct FastPseudoRandom {
 
     [[nodiscard]] std::uint64_t
     nextRandomWord() noexcept {
-        std::uint64_t z = (m_state += 0x9e3779b97f4a7c15ull);
-        z               = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
-        z               = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
-        return z ^ (z >> 31);
+        return detail::_splitmix64_mix(m_state += 0x9e3779b97f4a7c15ull);
+    }
+
+    // Bulk versions, same words as the equivalent number of 'nextRandomWord()' calls
+    // Word 'i' only depends on the state and 'i', so there are no dependencies between the lanes. Fixed size blocks of
+    // lanes vectorize even under the cheap cost models (GCC -O2)
+    void
+    fill_u64(std::span<std::uint64_t> out) noexcept {
+        _fill_lanes(out, [](std::uint64_t word) { return word; });
+    }
+
+    // Each in [0, maxInclusive]
+    void
+    fill_bounded(std::span<std::uint64_t> out, std::uint64_t maxInclusive) noexcept {
+        detail::_fill_bounded(*this, out, maxInclusive);
+    }
+
+    // Each in [0, 1)
+    void
+    fill_uniform_double(std::span<double> out) noexcept {
+        _fill_lanes(out, [](std::uint64_t word) { return detail::_to_unitDouble(word); });
+    }
+
+    // Same as calling 'nextRandomWord()' 'count' times, splitmix64 state just advances by a constant per word
+    void
+    discard(std::uint64_t count) noexcept {
+        m_state += count * 0x9e3779b97f4a7c15ull;
     }
 
     [[nodiscard]] static std::uint64_t
     multiplyHigh64(std::uint64_t lhs, std::uint64_t rhs) noexcept {
-#if defined(_MSC_VER) && ! defined(__clang__)
-        return __umulh(lhs, rhs);
-#else
-        return static_cast<std::uint64_t>((static_cast<unsigned __int128>(lhs) * rhs) >> 64);
-#endif
+        return detail::_multiplyHigh64(lhs, rhs);
     }
 
     [[nodiscard]] std::size_t
     pseudoRandom_0_to(std::size_t maxInclusive) noexcept {
-        if (maxInclusive == std::numeric_limits<std::size_t>::max()) {
-            return static_cast<std::size_t>(nextRandomWord());
+        return detail::_bounded([this] { return nextRandomWord(); }, maxInclusive);
+    }
+
+private:
+    template <typename T, typename F>
+    void
+    _fill_lanes(std::span<T> out, F const &convert) noexcept {
+        constexpr size_t    c_lanes = 8;
+        std::uint64_t const base    = m_state;
+
+        size_t const fullSz = out.size() - out.size() % c_lanes;
+        for (size_t i = 0; i < fullSz; i += c_lanes) {
+            for (size_t lane = 0; lane < c_lanes; ++lane) {
+                out[i + lane] = convert(detail::_splitmix64_mix(base + (i + lane + 1) * 0x9e3779b97f4a7c15ull));
+            }
         }
+        for (size_t i = fullSz; i < out.size(); ++i) {
+            out[i] = convert(detail::_splitmix64_mix(base + (i + 1) * 0x9e3779b97f4a7c15ull));
+        }
+        m_state = base + out.size() * 0x9e3779b97f4a7c15ull;
+    }
+};
 
-        auto const bound     = static_cast<std::uint64_t>(maxInclusive) + 1ull;
-        auto const threshold = (0ull - bound) % bound;
 
-        for (;;) {
-            auto const randomWord = nextRandomWord();
+// Counter based generator (Philox2x64-10 from Salmon et al. 'Parallel random numbers: as easy as 1, 2, 3')
+// Word 'pos' of stream 'streamID' is a pure function of (seed, streamID, pos). Streams derived from one seed are
+// independent of each other and of the order (or thread) in which they are consumed, so give every task its own
+// 'stream(taskID)' instead of reseeding. Also a UniformRandomBitGenerator, usable with the std distributions
+class StreamRandom {
+    static constexpr std::uint64_t c_multiplier = 0xD2B74407B1CE6E93ull;
+    static constexpr std::uint64_t c_keyBump    = 0x9E3779B97F4A7C15ull;
 
-#if defined(_MSC_VER) && ! defined(__clang__)
-            auto const low  = randomWord * bound;
-            auto const high = __umulh(randomWord, bound);
-#else
-            auto const product = static_cast<unsigned __int128>(randomWord) * bound;
-            auto const low     = static_cast<std::uint64_t>(product);
-            auto const high    = static_cast<std::uint64_t>(product >> 64);
-#endif
+    std::uint64_t                _m_seed;
+    std::uint64_t                _m_streamID;
+    std::uint64_t                _m_counter = 0; // Next block to generate, one block is 2 words
+    std::array<std::uint64_t, 2> _m_block{};
+    unsigned                     _m_blockPos = 2; // 2 means '_m_block' is used up
+
+public:
+    using result_type = std::uint64_t;
+
+    explicit constexpr StreamRandom(std::uint64_t seed, std::uint64_t streamID = 0) noexcept
+        : _m_seed(seed), _m_streamID(streamID) {}
+
+    // Independent stream from the same seed, starts at its beginning
+    [[nodiscard]] constexpr StreamRandom
+    stream(std::uint64_t streamID) const noexcept {
+        return StreamRandom(_m_seed, streamID);
+    }
+
+    [[nodiscard]] static constexpr std::array<std::uint64_t, 2>
+    block_at(std::uint64_t seed, std::uint64_t streamID, std::uint64_t blockID) noexcept {
+        std::array<std::uint64_t, 2> ctr{blockID, streamID};
+        std::uint64_t                key = seed;
+        for (int round = 0; round < 10; ++round) {
+            std::uint64_t const hi = detail::_multiplyHigh64(c_multiplier, ctr[0]);
+            std::uint64_t const lo = c_multiplier * ctr[0];
+            ctr                    = {hi ^ key ^ ctr[1], lo};
+            key                   += c_keyBump;
+        }
+        return ctr;
+    }
+
+    [[nodiscard]] static constexpr std::uint64_t
+    word_at(std::uint64_t seed, std::uint64_t streamID, std::uint64_t pos) noexcept {
+        return block_at(seed, streamID, pos / 2)[pos % 2];
+    }
+
+    [[nodiscard]] constexpr std::uint64_t
+    nextRandomWord() noexcept {
+        if (_m_blockPos == 2) {
+            _m_block    = block_at(_m_seed, _m_streamID, _m_counter++);
+            _m_blockPos = 0;
+        }
+        return _m_block[_m_blockPos++];
+    }
 
-            if (low >= threshold) { return static_cast<std::size_t>(high); }
+    [[nodiscard]] constexpr std::size_t
+    pseudoRandom_0_to(std::size_t maxInclusive) noexcept {
+        return detail::_bounded([this] { return nextRandomWord(); }, maxInclusive);
+    }
+
+    // Bulk versions, same words as the equivalent number of 'nextRandomWord()' calls
+    constexpr void
+    fill_u64(std::span<std::uint64_t> out) noexcept {
+        size_t done = 0;
+        for (; done < out.size() && _m_blockPos != 2; ++done) { out[done] = _m_block[_m_blockPos++]; }
+        for (; done + 2 <= out.size(); done += 2) {
+            auto const block = block_at(_m_seed, _m_streamID, _m_counter++);
+            out[done]        = block[0];
+            out[done + 1]    = block[1];
         }
+        for (; done < out.size(); ++done) { out[done] = nextRandomWord(); }
+    }
+
+    // Each in [0, maxInclusive]
+    constexpr void
+    fill_bounded(std::span<std::uint64_t> out, std::uint64_t maxInclusive) noexcept {
+        detail::_fill_bounded(*this, out, maxInclusive);
+    }
+
+    // Each in [0, 1)
+    constexpr void
+    fill_uniform_double(std::span<double> out) noexcept {
+        detail::_fill_uniformDouble(*this, out);
+    }
+
+    // Number of words generated so far
+    [[nodiscard]] constexpr std::uint64_t
+    position() const noexcept {
+        return _m_counter * 2 - (2 - _m_blockPos);
+    }
+
+    // Jumps to any position in O(1), backwards too
+    constexpr void
+    seek(std::uint64_t pos) noexcept {
+        _m_counter  = pos / 2;
+        _m_blockPos = 2;
+        if (pos % 2 != 0) {
+            _m_block    = block_at(_m_seed, _m_streamID, _m_counter++);
+            _m_blockPos = 1;
+        }
+    }
+
+    constexpr void
+    discard(std::uint64_t count) noexcept {
+        seek(position() + count);
+    }
+
+    [[nodiscard]] constexpr std::uint64_t
+    seed() const noexcept {
+        return _m_seed;
+    }
+    [[nodiscard]] constexpr std::uint64_t
+    streamID() const noexcept {
+        return _m_streamID;
+    }
+
+    constexpr result_type
+    operator()() noexcept {
+        return nextRandomWord();
+    }
+    static constexpr result_type
+    min() noexcept {
+        return 0;
+    }
+    static constexpr result_type
+    max() noexcept {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    friend constexpr bool
+    operator==(StreamRandom const &lhs, StreamRandom const &rhs) noexcept {
+        return lhs._m_seed == rhs._m_seed && lhs._m_streamID == rhs._m_streamID && lhs.position() == rhs.position();
     }
 };
 
+
+// #######################################
+// ### DISTRIBUTIONS   ###################
+// #######################################
+
+template <typename GEN>
+concept is_word_generator = requires(GEN &gen) {
+    { gen.nextRandomWord() } -> std::same_as<std::uint64_t>;
+};
+
+namespace detail {
+// Ziggurat tables (Marsaglia & Tsang, 'The Ziggurat Method for Generating Random Variables' with the simplifications
+// of Doornik's ZIGNOR). Every layer has area 'V', layer 0 is the base strip and the tail beyond 'R'
+// 'x' are the layer edges (decreasing, x[LAYERS] == 0), 'ratio[i]' is x[i + 1] / x[i] ... the quick accept bound
+template <size_t LAYERS>
+struct _Ziggurat {
+    std::array<double, LAYERS + 1> x;
+    std::array<double, LAYERS>     ratio;
+};
+
+template <size_t LAYERS>
+_Ziggurat<LAYERS>
+_make_ziggurat(double R, double V, auto const &density, auto const &inverseDensity) {
+    _Ziggurat<LAYERS> res;
+    res.x[0] = V / density(R);
+    res.x[1] = R;
+    for (size_t i = 2; i < LAYERS; ++i) { res.x[i] = inverseDensity(V / res.x[i - 1] + density(res.x[i - 1])); }
+    res.x[LAYERS] = 0.0;
+    for (size_t i = 0; i < LAYERS; ++i) { res.ratio[i] = res.x[i + 1] / res.x[i]; }
+    return res;
+}
+
+// Unnormalized densities of the standard normal and exponential distributions
+inline double
+_normalDensity(double x) noexcept {
+    return std::exp(-0.5 * x * x);
+}
+inline double
+_expDensity(double x) noexcept {
+    return std::exp(-x);
+}
+
+constexpr inline double c_normalZigR = 3.442619855899;
+constexpr inline double c_expZigR    = 7.69711747013104972;
+
+inline _Ziggurat<128> const &
+_normalZiggurat() {
+    static _Ziggurat<128> const res = _make_ziggurat<128>(c_normalZigR, 9.91256303526217e-3, _normalDensity,
+                                                          [](double y) { return std::sqrt(-2.0 * std::log(y)); });
+    return res;
+}
+inline _Ziggurat<256> const &
+_expZiggurat() {
+    static _Ziggurat<256> const res =
+        _make_ziggurat<256>(c_expZigR, 3.949659822581572e-3, _expDensity, [](double y) { return -std::log(y); });
+    return res;
+}
+
+// (0, 1] ... safe to take a logarithm of
+inline double
+_unitDouble_noZero(std::uint64_t word) noexcept {
+    return static_cast<double>((word >> 11) + 1) * 0x1.0p-53;
+}
+
+// The slow path of both samplers (about 1.5% of the samples for normal and 1.2% for exponential)
+// 'layer' and 'candidate' come from the word that failed the quick accept
+template <typename GEN>
+double
+_normal_slow(GEN &gen, _Ziggurat<128> const &zig, size_t layer, double candidate) noexcept {
+    for (;;) {
+        if (layer == 0) {
+            // Tail beyond R (Marsaglia 1964)
+            double tailX, tailY;
+            do {
+                tailX = -std::log(_unitDouble_noZero(gen.nextRandomWord())) / c_normalZigR;
+                tailY = -std::log(_unitDouble_noZero(gen.nextRandomWord()));
+            } while (tailY + tailY < tailX * tailX);
+            return candidate > 0 ? c_normalZigR + tailX : -(c_normalZigR + tailX);
+        }
+        double const x     = candidate * zig.x[layer];
+        double const yLow  = _normalDensity(zig.x[layer]);
+        double const yHigh = _normalDensity(zig.x[layer + 1]);
+        if (yLow + _to_unitDouble(gen.nextRandomWord()) * (yHigh - yLow) < _normalDensity(x)) { return x; }
+
+        std::uint64_t const word = gen.nextRandomWord();
+        layer                    = word & 127;
+        candidate                = static_cast<double>(static_cast<std::int64_t>(word) >> 11) * 0x1.0p-52;
+        if (std::abs(candidate) < zig.ratio[layer]) { return candidate * zig.x[layer]; }
+    }
+}
+
+template <typename GEN>
+double
+_exp_slow(GEN &gen, _Ziggurat<256> const &zig, size_t layer, double candidate) noexcept {
+    for (;;) {
+        // The tail of an exponential is again an exponential (shifted by R)
+        if (layer == 0) { return c_expZigR - std::log(_unitDouble_noZero(gen.nextRandomWord())); }
+        double const x     = candidate * zig.x[layer];
+        double const yLow  = _expDensity(zig.x[layer]);
+        double const yHigh = _expDensity(zig.x[layer + 1]);
+        if (yLow + _to_unitDouble(gen.nextRandomWord()) * (yHigh - yLow) < _expDensity(x)) { return x; }
+
+        std::uint64_t const word = gen.nextRandomWord();
+        layer                    = word & 255;
+        candidate                = _to_unitDouble(word);
+        if (candidate < zig.ratio[layer]) { return candidate * zig.x[layer]; }
+    }
+}
+
+// One word per sample on the quick path: low bits pick the layer, top 53 bits are the position within it
+template <typename GEN>
+double
+_normal_fromWord(GEN &gen, _Ziggurat<128> const &zig, std::uint64_t word) noexcept {
+    size_t const layer     = word & 127;
+    double const candidate = static_cast<double>(static_cast<std::int64_t>(word) >> 11) * 0x1.0p-52;
+    if (std::abs(candidate) < zig.ratio[layer]) { return candidate * zig.x[layer]; }
+    return _normal_slow(gen, zig, layer, candidate);
+}
+
+template <typename GEN>
+double
+_exp_fromWord(GEN &gen, _Ziggurat<256> const &zig, std::uint64_t word) noexcept {
+    size_t const layer     = word & 255;
+    double const candidate = _to_unitDouble(word);
+    if (candidate < zig.ratio[layer]) { return candidate * zig.x[layer]; }
+    return _exp_slow(gen, zig, layer, candidate);
+}
+
+// Words are generated in bulk, only the samples that miss the quick path draw more
+template <typename GEN>
+void
+_fill_fromWords(GEN &gen, std::span<double> out, auto const &fromWord) noexcept {
+    std::array<std::uint64_t, c_fillChunkSz> buf;
+    for (size_t done = 0; done < out.size(); done += buf.size()) {
+        size_t const chunkSz = std::min(buf.size(), out.size() - done);
+        gen.fill_u64(std::span(buf.data(), chunkSz));
+        for (size_t i = 0; i < chunkSz; ++i) { out[done + i] = fromWord(buf[i]); }
+    }
+}
+} // namespace detail
+
+
+// Ziggurat samplers, work with any generator that has 'nextRandomWord()' (bulk versions also need 'fill_u64')
+template <typename GEN>
+requires is_word_generator<GEN>
+double
+sample_normal(GEN &gen, double mean = 0.0, double stdDeviation = 1.0) noexcept {
+    return mean + stdDeviation * detail::_normal_fromWord(gen, detail::_normalZiggurat(), gen.nextRandomWord());
+}
+
+template <typename GEN>
+requires is_word_generator<GEN>
+double
+sample_exponential(GEN &gen, double rate = 1.0) noexcept {
+    return detail::_exp_fromWord(gen, detail::_expZiggurat(), gen.nextRandomWord()) / rate;
+}
+
+template <typename GEN>
+requires is_word_generator<GEN>
+void
+fill_normal(GEN &gen, std::span<double> out, double mean = 0.0, double stdDeviation = 1.0) noexcept {
+    auto const &zig = detail::_normalZiggurat();
+    detail::_fill_fromWords(gen, out, [&](std::uint64_t word) {
+        return mean + stdDeviation * detail::_normal_fromWord(gen, zig, word);
+    });
+}
+
+template <typename GEN>
+requires is_word_generator<GEN>
+void
+fill_exponential(GEN &gen, std::span<double> out, double rate = 1.0) noexcept {
+    auto const  &zig     = detail::_expZiggurat();
+    double const invRate = 1.0 / rate;
+    detail::_fill_fromWords(gen, out,
+                            [&](std::uint64_t word) { return detail::_exp_fromWord(gen, zig, word) * invRate; });
+}
+
 } // namespace incom::standard::random
\ No newline at end of file
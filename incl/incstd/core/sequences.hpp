@@ -2,10 +2,15 @@
 
 #include <cassert>
 #include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include <ankerl/unordered_dense.h>
 #include <more_concepts/more_concepts.hpp>
 
+#include <incstd/core/containers.hpp>
+#include <incstd/core/coroutines.hpp>
 #include <incstd/core/hashing.hpp>
 
 
@@ -77,97 +82,147 @@ build_map_uniqueSubSeq2startPos(T const &inputSequence, int const min_occurenceO
 }
 
 namespace solvers {
-template <typename T, typename F, size_t max_numOfRes = 1, size_t min_repCountOfUnique = 1,
+// Lazy version of 'solve_seqFromRepUniqueSubseq', yields the results one by one as they are found
+// The yielded reference is valid until the generator is resumed, 'inputSequence' must outlive the generator
+template <typename T, typename F, size_t min_repCountOfUnique = 1,
           size_t max_repCountOfUnique = std::numeric_limits<size_t>::max()>
 requires more_concepts::container<T> && std::predicate<F, std::vector<typename T::value_type>>
-auto
-solve_seqFromRepUniqueSubseq(T const &inputSequence, F const filter_subSeq,
-                             int const max_ofUniqueSubseqInRes = std::numeric_limits<int>::max(),
-                             int const min_ofUniqueSubseqInRes = 1, int min_occurenceOfUniqueSubseq = 1,
-                             int const max_subSeqSize = std::numeric_limits<int>::max(), int const min_subSeqSize = 1)
-    -> std::optional<std::vector<std::vector<std::vector<typename T::value_type>>>> {
+coroutines::generator<std::vector<std::vector<typename T::value_type>> const &>
+generate_seqFromRepUniqueSubseq(T const &inputSequence, F const filter_subSeq,
+                                int const max_ofUniqueSubseqInRes = std::numeric_limits<int>::max(),
+                                int const min_ofUniqueSubseqInRes = 1, int min_occurenceOfUniqueSubseq = 1,
+                                int const max_subSeqSize = std::numeric_limits<int>::max(),
+                                int const min_subSeqSize = 1) {
+    using subSeq_t = std::vector<typename T::value_type>;
 
+    static_assert(max_repCountOfUnique != 0,
+                  "Trying to solve for 'maximum repeat count of unique subsequence = 0' does not make sense");
     assert((void("Maximum number of unique subsequence in result cannot be less than 1"), max_ofUniqueSubseqInRes > 0));
     assert((void("Maximum number of unique subsequence in result cannot be less than minimum number of unique "
                  "subsequences in result"),
             max_ofUniqueSubseqInRes >= min_ofUniqueSubseqInRes));
 
-    ankerl::unordered_dense::map<std::vector<typename T::value_type>,
-                                 ankerl::unordered_dense::set<size_t, hashing::XXH3Hasher>, hashing::XXH3Hasher> const
-        mp_subseq_2_ids = build_map_uniqueSubSeq2startPos(inputSequence, filter_subSeq, min_occurenceOfUniqueSubseq,
-                                                          max_subSeqSize, min_subSeqSize);
+    ankerl::unordered_dense::map<subSeq_t, ankerl::unordered_dense::set<size_t, hashing::XXH3Hasher>,
+                                 hashing::XXH3Hasher> const mp_subseq_2_ids =
+        build_map_uniqueSubSeq2startPos(inputSequence, filter_subSeq, min_occurenceOfUniqueSubseq, max_subSeqSize,
+                                        min_subSeqSize);
 
-    ankerl::unordered_dense::map<size_t, std::vector<std::vector<typename T::value_type>>, hashing::XXH3Hasher>
-        mp_pos_2_subseq;
+    ankerl::unordered_dense::map<size_t, std::vector<subSeq_t>, hashing::XXH3Hasher> mp_pos_2_subseq;
 
     for (auto const &mpItem : mp_subseq_2_ids) {
         for (auto const &posItem : mpItem.second) {
-            mp_pos_2_subseq.insert({posItem, std::vector<std::vector<typename T::value_type>>()});
+            mp_pos_2_subseq.insert({posItem, std::vector<subSeq_t>()});
             mp_pos_2_subseq[posItem].push_back(mpItem.first);
         }
     }
+    std::vector<subSeq_t> const noOptions;
+    auto const                  options_at = [&](size_t pos) -> std::vector<subSeq_t> const & {
+        auto const found = mp_pos_2_subseq.find(pos);
+        return found == mp_pos_2_subseq.end() ? noOptions : found->second;
+    };
 
     constexpr size_t const min_repCountOfUnique_adj = (min_repCountOfUnique == 0 ? 1 : min_repCountOfUnique);
     size_t                 curHead                  = 0;
 
-    ankerl::unordered_dense::map<typename std::vector<typename T::value_type>, size_t, hashing::XXH3Hasher> selTracker;
-    if constexpr (max_repCountOfUnique == 0) {
-        static_assert(false,
-                      "Trying to solve for 'maximum repeat count of unique subsequence = 0' does not make sense");
-    }
+    // Usually holds only a handful of unique subsequences at a time, stays inline (no heap) up to 16 of them
+    containers::SmallFlatMap<subSeq_t, size_t, 16, hashing::XXH3Hasher> selTracker;
+    size_t                                                               inSelTrack_smaller = 0;
+    std::vector<subSeq_t>                                                res_inProgress;
 
-    if constexpr (max_numOfRes == 0) {
-        static_assert(false, "Trying to solve for 'maximum number of results = 0' does not make sense");
-    }
-    else {
-        size_t                                                        inSelTrack_smaller = 0;
-        std::vector<std::vector<typename T::value_type>>              res_inProgress;
-        std::vector<std::vector<std::vector<typename T::value_type>>> res_storage;
+    auto const unselect = [&](subSeq_t const &selOption) {
+        curHead -= selOption.size();
+        if (selTracker.at(selOption) == min_repCountOfUnique_adj) { inSelTrack_smaller++; }
+        res_inProgress.pop_back();
 
-        // Recursive solver.
-        // Explores in a DFS manner all the possible arrangements of subsequences from the beginning
-        // Respects how many different subsequences can be used (therefore short circuits on most of the unsuitable
-        // parts of the tree)
-        auto rec_inside_solver = [&](this auto &self) -> void {
-            for (auto const &selOption : mp_pos_2_subseq[curHead]) {
+        selTracker.at(selOption)--;
+        if (selTracker.at(selOption) == 0) {
+            selTracker.erase(selOption);
+            inSelTrack_smaller--;
+        }
+    };
+
+    // Explores in a DFS manner all the possible arrangements of subsequences from the beginning
+    // Respects how many different subsequences can be used (therefore short circuits on most of the unsuitable
+    // parts of the tree)
+    // Explicit stack instead of recursion, so that the results can be yielded from any depth
+    struct Level {
+        std::vector<subSeq_t> const *options;
+        size_t                       nextID;
+        subSeq_t const              *selected;
+    };
+    std::vector<Level> dfsStack{Level{&options_at(0), 0, nullptr}};
+
+    while (not dfsStack.empty()) {
+        Level &lvl = dfsStack.back();
+        if (lvl.selected != nullptr) { unselect(*std::exchange(lvl.selected, nullptr)); }
+        if (lvl.nextID == lvl.options->size()) {
+            dfsStack.pop_back();
+            continue;
+        }
 
-                if (selTracker.contains(selOption)) {
-                    if (selTracker.at(selOption) == max_repCountOfUnique) { continue; }
-                    selTracker.at(selOption)++;
-                }
-                else if (selTracker.size() < max_ofUniqueSubseqInRes) {
-                    selTracker.emplace(selOption, 1);
-                    inSelTrack_smaller++;
-                }
-                else { continue; }
+        subSeq_t const &selOption = (*lvl.options)[lvl.nextID++];
+        if (selTracker.contains(selOption)) {
+            if (selTracker.at(selOption) == max_repCountOfUnique) { continue; }
+            selTracker.at(selOption)++;
+        }
+        else if (selTracker.size() < max_ofUniqueSubseqInRes) {
+            selTracker.emplace(selOption, 1);
+            inSelTrack_smaller++;
+        }
+        else { continue; }
 
-                res_inProgress.push_back(selOption);
-                if (selTracker.at(selOption) == min_repCountOfUnique_adj) { inSelTrack_smaller--; }
-                curHead += selOption.size();
+        res_inProgress.push_back(selOption);
+        if (selTracker.at(selOption) == min_repCountOfUnique_adj) { inSelTrack_smaller--; }
+        curHead      += selOption.size();
+        lvl.selected  = &selOption;
 
-                if (curHead == inputSequence.size() && selTracker.size() >= min_ofUniqueSubseqInRes &&
-                    inSelTrack_smaller == 0) {
-                    res_storage.push_back(res_inProgress); // Success! push_back one result, return one level up
-                }
-                // Recursive call
-                else { self(); }
+        if (curHead == inputSequence.size() && selTracker.size() >= min_ofUniqueSubseqInRes &&
+            inSelTrack_smaller == 0) {
+            co_yield res_inProgress; // Success! yield one result, then continue with the next option
+        }
+        else { dfsStack.push_back(Level{&options_at(curHead), 0, nullptr}); }
+    }
+}
 
-                if (res_storage.size() == max_numOfRes) { return; }
+template <typename T, size_t min_repCountOfUnique = 1,
+          size_t max_repCountOfUnique = std::numeric_limits<size_t>::max()>
+requires more_concepts::container<T>
+// Overload: No filter of subsequences
+coroutines::generator<std::vector<std::vector<typename T::value_type>> const &>
+generate_seqFromRepUniqueSubseq(T const  &inputSequence,
+                                int const max_ofUniqueSubseqInRes = std::numeric_limits<int>::max(),
+                                int const min_ofUniqueSubseqInRes = 1, int min_occurenceOfUniqueSubseq = 1,
+                                int const max_subSeqSize = std::numeric_limits<int>::max(),
+                                int const min_subSeqSize = 1) {
+    auto funcToPass = [](std::vector<typename T::value_type> const &a) { return true; };
+    return generate_seqFromRepUniqueSubseq<T, decltype(funcToPass), min_repCountOfUnique, max_repCountOfUnique>(
+        inputSequence, funcToPass, max_ofUniqueSubseqInRes, min_ofUniqueSubseqInRes, min_occurenceOfUniqueSubseq,
+        max_subSeqSize, min_subSeqSize);
+}
 
-                curHead -= selOption.size();
-                if (selTracker.at(selOption) == min_repCountOfUnique_adj) { inSelTrack_smaller++; }
-                res_inProgress.pop_back();
 
-                selTracker.at(selOption)--;
-                if (selTracker.at(selOption) == 0) {
-                    selTracker.erase(selOption);
-                    inSelTrack_smaller--;
-                }
-            }
-            return;
-        };
+template <typename T, typename F, size_t max_numOfRes = 1, size_t min_repCountOfUnique = 1,
+          size_t max_repCountOfUnique = std::numeric_limits<size_t>::max()>
+requires more_concepts::container<T> && std::predicate<F, std::vector<typename T::value_type>>
+auto
+solve_seqFromRepUniqueSubseq(T const &inputSequence, F const filter_subSeq,
+                             int const max_ofUniqueSubseqInRes = std::numeric_limits<int>::max(),
+                             int const min_ofUniqueSubseqInRes = 1, int min_occurenceOfUniqueSubseq = 1,
+                             int const max_subSeqSize = std::numeric_limits<int>::max(), int const min_subSeqSize = 1)
+    -> std::optional<std::vector<std::vector<std::vector<typename T::value_type>>>> {
+
+    if constexpr (max_numOfRes == 0) {
+        static_assert(false, "Trying to solve for 'maximum number of results = 0' does not make sense");
+    }
+    else {
+        std::vector<std::vector<std::vector<typename T::value_type>>> res_storage;
+        for (auto const &oneRes : generate_seqFromRepUniqueSubseq<T, F, min_repCountOfUnique, max_repCountOfUnique>(
+                 inputSequence, filter_subSeq, max_ofUniqueSubseqInRes, min_ofUniqueSubseqInRes,
+                 min_occurenceOfUniqueSubseq, max_subSeqSize, min_subSeqSize)) {
+            res_storage.push_back(oneRes);
+            if (res_storage.size() == max_numOfRes) { break; }
+        }
 
-        rec_inside_solver();
         if (res_storage.empty()) { return std::nullopt; }
         else { return res_storage; }
     }
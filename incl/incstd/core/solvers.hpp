@@ -5,11 +5,13 @@
 #include <deque>
 #include <format>
 #include <limits>
+#include <memory_resource>
 #include <ranges>
 
 
 #include <ankerl/unordered_dense.h>
 
+#include <incstd/core/containers.hpp>
 #include <incstd/core/explorers.hpp>
 #include <incstd/core/hashing.hpp>
 #include <incstd/core/matrix.hpp>
@@ -261,24 +263,10 @@ public:
         compute_alternsRotFlip() const {
             namespace incmatrix = incom::standard::matrix;
 
-            auto                                                                                m_matrix_cpy = m_matrix;
-            ankerl::unordered_dense::set<decltype(m_matrix_cpy), standard::hashing::XXH3Hasher> hlprMP;
-
-            hlprMP.insert(m_matrix_cpy);
-            for (int rot_i = 0; rot_i < 3; ++rot_i) {
-                incmatrix::matrixRotateLeft(m_matrix_cpy);
-                hlprMP.insert(m_matrix_cpy);
-            }
-
-            // Flip vertically
-            for (size_t i = 0uz; i < (m_matrix_cpy.size() / 2); ++i) {
-                std::swap(m_matrix_cpy.at(i), m_matrix_cpy.at(m_matrix_cpy.size() - 1 - i));
-            }
-
-            hlprMP.insert(m_matrix_cpy);
-            for (int rot_i = 0; rot_i < 3; ++rot_i) {
-                incmatrix::matrixRotateLeft(m_matrix_cpy);
-                hlprMP.insert(m_matrix_cpy);
+            // At most 8 distinct alternatives, linear search for duplicates is cheaper than hashing
+            containers::SmallVector<decltype(m_matrix), 8> hlprMP;
+            for (auto const &mtrx : incmatrix::compute_dihedralVariants(m_matrix)) {
+                if (std::ranges::find(hlprMP, mtrx) == hlprMP.end()) { hlprMP.push_back(mtrx); }
             }
 
             return std::vector<Shape>(hlprMP.begin(), hlprMP.end());
@@ -314,11 +302,13 @@ public:
         Type type = Type::Gapcreating;
     };
 
-    using possibilitiesByShape_t     = std::vector<std::vector<PastRes>>;
+    // Memoized possibilities allocate from the memory resource of the pastResMap_t they are stored in
+    // Construct the pastResMap_t with an 'allocators::MonotonicArena' (or similar) to release them all at once
+    using possibilitiesByShape_t     = std::pmr::vector<std::pmr::vector<PastRes>>;
     using frontierTilePossibs_t      = std::optional<std::reference_wrapper<possibilitiesByShape_t>>;
     using consideredOptionsByShape_t = std::vector<std::vector<ConsideredShapeOption>>;
-    using pastResMap_t =
-        ankerl::unordered_dense::segmented_map<Shape, possibilitiesByShape_t, incom::standard::hashing::XXH3Hasher>;
+    using pastResMap_t = ankerl::unordered_dense::pmr::segmented_map<Shape, possibilitiesByShape_t,
+                                                                     incom::standard::hashing::XXH3Hasher>;
 
     struct SolverPolicy {
         struct SelectionState {
@@ -718,7 +708,7 @@ private:
     }
 
     [[nodiscard]] bool
-    has_useableAlternatives(std::vector<PastRes> const &oneShpAltsVec) const {
+    has_useableAlternatives(std::pmr::vector<PastRes> const &oneShpAltsVec) const {
         if (oneShpAltsVec.empty()) { return false; }
         return m_useableCount_perShape.at(oneShpAltsVec.front().ol_shpID.shpID) > 0uz;
     }
@@ -761,7 +751,8 @@ private:
 
     possibilitiesByShape_t &
     getOrCompute_possibsFor(Shape const &tile) {
-        auto insRes = m_pastComputed.insert({tile, possibilitiesByShape_t(m_shapes_alterns.size())});
+        auto insRes = m_pastComputed.insert(
+            {tile, possibilitiesByShape_t(m_shapes_alterns.size(), m_pastComputed.get_allocator().resource())});
         if (insRes.second) {
             possibilitiesByShape_t &vpr = insRes.first->second;
 
@@ -791,17 +782,23 @@ private:
 
         auto const perShpScoringAdj = compute_perShapeScoringAdjustments();
 
+        auto const frontAsStart = [&]() {
+            return std::array{static_cast<size_t>(m_uncoverableFrontierPoss.front().y),
+                              static_cast<size_t>(m_uncoverableFrontierPoss.front().x)};
+        };
+
+        // One explorer for all the uncoverable points, 'reset' only clears what the previous exploration touched
+        auto explr = explorers::Chebyshev(
+            [&](std::array<size_t, 2> const &item) { return m_area.at(item[0]).at(item[1]) == 0; }, frontAsStart(),
+            std::array{m_area.size(), m_area.empty() ? 0uz : m_area.front().size()});
+
         while (not m_uncoverableFrontierPoss.empty()) {
             if (m_area.at(m_uncoverableFrontierPoss.front().y).at(m_uncoverableFrontierPoss.front().x) != 0) {
                 m_uncoverableFrontierPoss.pop_front();
                 continue;
             }
 
-            auto explr = explorers::Chebyshev(
-                [&](std::array<size_t, 2> const &item) { return m_area.at(item[0]).at(item[1]) == 0; },
-                std::array{static_cast<size_t>(m_uncoverableFrontierPoss.front().y),
-                           static_cast<size_t>(m_uncoverableFrontierPoss.front().x)},
-                std::array{m_area.size(), m_area.empty() ? 0uz : m_area.front().size()});
+            explr.reset(frontAsStart());
 
 
             auto eva = [&](std::vector<Pos> const &poss) -> std::optional<consideredOptionsByShape_t> {
@@ -1129,20 +1126,9 @@ public:
     calculate_rotFlipped(std::array<std::array<bool, SQSZ - 2>, SQSZ - 2> input) {
         namespace incmatrix = incom::standard::matrix;
 
-        ankerl::unordered_dense::set<decltype(input), standard::hashing::XXH3Hasher> hlprMP;
-        hlprMP.insert(input);
-        for (int rot_i = 0; rot_i < 3; ++rot_i) {
-            incmatrix::matrixRotateLeft(input);
-            hlprMP.insert(input);
-        }
-
-        // Flip vertically
-        for (size_t i = 0uz; i < (input.size() / 2); ++i) { std::swap(input.at(i), input.at(input.size() - 1 - i)); }
-
-        hlprMP.insert(input);
-        for (int rot_i = 0; rot_i < 3; ++rot_i) {
-            incmatrix::matrixRotateLeft(input);
-            hlprMP.insert(input);
+        containers::SmallVector<decltype(input), 8> hlprMP;
+        for (auto const &mtrx : incmatrix::compute_dihedralVariants(input)) {
+            if (std::ranges::find(hlprMP, mtrx) == hlprMP.end()) { hlprMP.push_back(mtrx); }
         }
         return std::vector<decltype(input)>(hlprMP.begin(), hlprMP.end());
     }
@@ -1,6 +1,18 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
 #include <ranges>
+#include <span>
+#include <stdexcept>
+#include <tuple>
 #include <utility>
 
 #include <incstd/core/typegen.hpp>
@@ -28,8 +40,14 @@ class _kcomb_iter {
     static constexpr auto idxSeq_rev = transform_integer_sequence<std::views::reverse, decltype(idxSeq)>{};
 
     template <size_t... I>
-    constexpr _kcomb_iter(std::index_sequence<I...>, base_iterator begin, base_sentinel end)
-        : iters{(std::next(begin, I))...}, end_iters{std::next(begin, I + (end - begin) - (K - 1))...} {}
+    constexpr _kcomb_iter(std::index_sequence<I...> seq, base_iterator begin, base_sentinel end)
+        : _kcomb_iter(seq, begin, end, static_cast<size_t>(std::ranges::distance(begin, end))) {}
+
+    // Fewer than K elements means no combinations, everything starts in the end state right away
+    template <size_t... I>
+    constexpr _kcomb_iter(std::index_sequence<I...>, base_iterator begin, base_sentinel end, size_t const n)
+        : iters{(n < K ? std::ranges::next(begin, end) : std::next(begin, I))...},
+          end_iters{(n < K ? std::ranges::next(begin, end) : std::next(begin, I + n - (K - 1)))...} {}
 
 public:
     using value_type        = c_generateTuple<K, base_value_type>::type;
@@ -94,9 +112,418 @@ public:
     }
 };
 
-template <std::ranges::forward_range RANGE, size_t K>
-requires std::ranges::view<RANGE> && (K > 1)
-class _kcomb_view : public std::ranges::view_interface<_kcomb_view<RANGE, K>> {
+
+template <typename RANGE>
+concept _is_randomAccessSized = std::ranges::random_access_range<RANGE const> && std::ranges::sized_range<RANGE const>;
+
+// Sizes of the views saturate at max size_t, such a view cannot be unranked (nor chunked) correctly
+// Only forward iteration from the beginning works then
+constexpr void
+_throw_ifSaturated(size_t const total) {
+    if (total == std::numeric_limits<size_t>::max()) {
+        throw std::overflow_error("Combinatorial view: too many elements for size_t, only forward iteration possible");
+    }
+}
+
+// Consecutive chunks of 'chunkSz' elements (the last one possibly shorter) of a random access view, same as
+// 'std::views::chunk'. Every chunk starts with one unranking, so the chunks can be enumerated independently (ie. on
+// different threads)
+template <typename VIEW>
+constexpr auto
+_chunked(VIEW const &view, size_t const chunkSz) {
+    assert((void("Chunk size must be at least 1"), chunkSz > 0));
+    size_t const total = std::ranges::size(view);
+    _throw_ifSaturated(total);
+    return std::views::iota(0uz, (total + chunkSz - 1) / chunkSz) |
+           std::views::transform([first = std::ranges::begin(view), total, chunkSz](size_t chunkID) {
+               return std::ranges::subrange(
+                   first + static_cast<std::ptrdiff_t>(chunkID * chunkSz),
+                   first + static_cast<std::ptrdiff_t>(std::min(total, (chunkID + 1) * chunkSz)));
+           });
+}
+
+
+// Combinatorial number system, combinations of indices in lexicographic order
+// Saturates at max size_t instead of overflowing
+constexpr size_t
+_binomial(size_t n, size_t k) noexcept {
+    if (k > n) { return 0; }
+    k          = std::min(k, n - k);
+    size_t res = 1;
+    for (size_t i = 1; i <= k; ++i) {
+        // 'res * (n - k + i)' is always divisible by 'i', dividing first keeps the intermediate small
+        size_t const gcd    = std::gcd(res, i);
+        size_t const factor = (n - k + i) / (i / gcd);
+        res                /= gcd;
+        if (res > std::numeric_limits<size_t>::max() / factor) { return std::numeric_limits<size_t>::max(); }
+        res *= factor;
+    }
+    return res;
+}
+
+// Indices of the 'rank'-th (lexicographically) K-combination out of 'n', 'C(n, K)' must not saturate
+// Lexicographic rank 'r' is colexicographic rank 'C(n, K) - 1 - r' of the mirrored ('n - 1 - index') combination, that
+// one is decomposed greedily into 'C(c_K, K) + ... + C(c_1, 1)' with a binary search for each 'c'
+template <size_t K>
+constexpr std::array<size_t, K>
+_unrank_combination(size_t const n, size_t const rank) noexcept {
+    std::array<size_t, K> res;
+    size_t                remaining = _binomial(n, K) - 1 - rank;
+    size_t                upper     = n;
+    for (size_t i = 0; i < K; ++i) {
+        size_t const j = K - i;
+        size_t       lo = j - 1, hi = upper - 1;
+        while (lo < hi) {
+            size_t const mid = lo + (hi - lo + 1) / 2;
+            if (_binomial(mid, j) <= remaining) { lo = mid; }
+            else { hi = mid - 1; }
+        }
+        remaining -= _binomial(lo, j);
+        res[i]     = n - 1 - lo;
+        upper      = lo;
+    }
+    return res;
+}
+
+// Random access version for random access sized ranges, holds the iterators and the rank of the current combination
+// Any combination can be jumped to directly (unranking), so the view can be split into chunks for parallel enumeration
+// With 'REP' the same element can repeat (multisets), those are in bijection with plain K-combinations out of
+// 'n + K - 1' through 'index[i] + i'
+template <std::ranges::random_access_range RANGE, size_t K, bool REP = false>
+requires(K > 1)
+class _kcomb_raIter {
+    using base_iterator  = std::ranges::iterator_t<RANGE const>;
+    using base_reference = std::ranges::range_reference_t<RANGE const>;
+
+    std::array<base_iterator, K> iters{};
+    base_iterator                m_begin{};
+    base_iterator                m_end{};
+    size_t                       m_n     = 0;
+    size_t                       m_total = 0;
+    size_t                       m_rank  = 0;
+
+    static constexpr auto idxSeq = std::make_index_sequence<K>{};
+
+public:
+    using value_type        = c_generateTuple<K, std::ranges::range_value_t<RANGE const>>::type;
+    using reference         = c_generateTuple<K, base_reference>::type;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    [[nodiscard]] constexpr _kcomb_raIter() = default;
+
+    [[nodiscard]] constexpr _kcomb_raIter(base_iterator begin, size_t n, size_t rank)
+        : m_begin(begin), m_end(begin + static_cast<difference_type>(n)), m_n(n),
+          m_total(REP ? (n == 0 ? 0 : _binomial(n + K - 1, K)) : _binomial(n, K)) {
+        _jump_to(rank);
+    }
+
+    [[nodiscard]] constexpr size_t
+    rank() const noexcept {
+        return m_rank;
+    }
+    [[nodiscard]] constexpr std::array<size_t, K>
+    indices() const noexcept {
+        std::array<size_t, K> res;
+        for (size_t i = 0; i < K; ++i) { res[i] = static_cast<size_t>(iters[i] - m_begin); }
+        return res;
+    }
+
+    // Amortized O(1), all but 1 in 'n - K + 1' increments just bump the last iterator
+    constexpr auto
+    operator++() -> _kcomb_raIter & {
+        ++m_rank;
+        if (++iters[K - 1] != m_end) { return *this; }
+
+        // Only compile time indices into 'iters' ... lets the compiler keep them in registers
+        auto lam = [&]<size_t... Is>(std::integer_sequence<size_t, Is...>) -> void {
+            // Rightmost one that can still move forward ('Is' go from K - 2 down to 0), the ones after it follow it
+            size_t moved = K;
+            (void)((iters[K - 2 - Is] - m_begin < static_cast<difference_type>(REP ? m_n - 1 : m_n - 2 - Is)
+                        ? (++iters[K - 2 - Is], moved = K - 2 - Is, true)
+                        : false) ||
+                   ...);
+            if (moved == K) { return; }
+            if constexpr (REP) { ((void)(Is + 1 > moved && (iters[Is + 1] = iters[Is], true)), ...); }
+            else { ((void)(Is + 1 > moved && (iters[Is + 1] = std::next(iters[Is]), true)), ...); }
+        };
+        lam(std::make_index_sequence<K - 1>{});
+        return *this;
+    }
+    constexpr auto
+    operator--() -> _kcomb_raIter & {
+        if (m_rank == m_total) {
+            _jump_to(m_rank - 1);
+            return *this;
+        }
+        --m_rank;
+        for (size_t i = K; i-- > 0;) {
+            if (iters[i] != (i == 0 ? m_begin : (REP ? iters[i - 1] : std::next(iters[i - 1])))) {
+                --iters[i];
+                for (size_t j = i + 1; j < K; ++j) {
+                    iters[j] = REP ? std::prev(m_end) : m_begin + static_cast<difference_type>(m_n - K + j);
+                }
+                return *this;
+            }
+        }
+        return *this;
+    }
+    [[nodiscard]] constexpr auto
+    operator++(int) -> _kcomb_raIter {
+        auto const pre = *this;
+        ++(*this);
+        return pre;
+    }
+    [[nodiscard]] constexpr auto
+    operator--(int) -> _kcomb_raIter {
+        auto const pre = *this;
+        --(*this);
+        return pre;
+    }
+
+    constexpr auto
+    operator+=(difference_type diff) -> _kcomb_raIter & {
+        _jump_to(static_cast<size_t>(static_cast<difference_type>(m_rank) + diff));
+        return *this;
+    }
+    constexpr auto
+    operator-=(difference_type diff) -> _kcomb_raIter & {
+        return *this += -diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator+(_kcomb_raIter it, difference_type diff) -> _kcomb_raIter {
+        return it += diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator+(difference_type diff, _kcomb_raIter it) -> _kcomb_raIter {
+        return it += diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator-(_kcomb_raIter it, difference_type diff) -> _kcomb_raIter {
+        return it -= diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator-(_kcomb_raIter const &lhs, _kcomb_raIter const &rhs) -> difference_type {
+        return static_cast<difference_type>(lhs.m_rank) - static_cast<difference_type>(rhs.m_rank);
+    }
+
+    [[nodiscard]] constexpr auto
+    operator*() const -> reference {
+        auto lam = [&]<size_t... Is>(std::integer_sequence<size_t, Is...>) -> reference {
+            return std::tie(*iters[Is]...);
+        };
+        return lam(idxSeq);
+    }
+    [[nodiscard]] constexpr auto
+    operator[](difference_type diff) const -> reference {
+        return *(*this + diff);
+    }
+
+    // Only iterators of the same view are comparable, the rank says it all
+    [[nodiscard]] constexpr auto
+    operator==(_kcomb_raIter const &other) const -> bool {
+        return m_rank == other.m_rank;
+    }
+    [[nodiscard]] constexpr auto
+    operator<=>(_kcomb_raIter const &other) const {
+        return m_rank <=> other.m_rank;
+    }
+
+private:
+    constexpr void
+    _jump_to(size_t rank) {
+        m_rank = rank;
+        if (rank >= m_total) { return; }
+        if (rank != 0) { _throw_ifSaturated(m_total); }
+
+        std::array<size_t, K> idxs;
+        if (rank == 0) {
+            for (size_t i = 0; i < K; ++i) { idxs[i] = REP ? 0 : i; }
+        }
+        else if constexpr (REP) {
+            idxs = _unrank_combination<K>(m_n + K - 1, rank);
+            for (size_t i = 0; i < K; ++i) { idxs[i] -= i; }
+        }
+        else { idxs = _unrank_combination<K>(m_n, rank); }
+        for (size_t i = 0; i < K; ++i) { iters[i] = m_begin + static_cast<difference_type>(idxs[i]); }
+    }
+};
+
+// Index only version for 'combinations_k_indices', the 32bit indices themselves are the value
+template <size_t K, bool REP = false>
+requires(K > 1)
+class _kcomb_idxIter {
+    using idx_type = std::uint32_t;
+
+    std::array<idx_type, K> idxs{};
+    idx_type                m_n     = 0;
+    size_t                  m_total = 0;
+    size_t                  m_rank  = 0;
+
+public:
+    using value_type        = std::array<idx_type, K>;
+    using reference         = value_type;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    [[nodiscard]] constexpr _kcomb_idxIter() = default;
+
+    [[nodiscard]] constexpr _kcomb_idxIter(size_t n, size_t rank)
+        : m_n(static_cast<idx_type>(n)),
+          m_total(REP ? (n == 0 ? 0 : _binomial(n + K - 1, K)) : _binomial(n, K)) {
+        assert((void("Combinations: more elements than 32bit indices can hold"),
+                n <= std::numeric_limits<idx_type>::max()));
+        _jump_to(rank);
+    }
+
+    [[nodiscard]] constexpr size_t
+    rank() const noexcept {
+        return m_rank;
+    }
+    // Same as the other combination iterators, the value has the 32bit ones
+    [[nodiscard]] constexpr std::array<size_t, K>
+    indices() const noexcept {
+        std::array<size_t, K> res;
+        for (size_t i = 0; i < K; ++i) { res[i] = idxs[i]; }
+        return res;
+    }
+
+    // Amortized O(1), all but 1 in 'n - K + 1' increments just bump the last index
+    constexpr auto
+    operator++() -> _kcomb_idxIter & {
+        ++m_rank;
+        if (++idxs[K - 1] != m_n) { return *this; }
+
+        auto lam = [&]<size_t... Is>(std::integer_sequence<size_t, Is...>) -> void {
+            size_t moved = K;
+            (void)((idxs[K - 2 - Is] < (REP ? m_n - 1 : m_n - 2 - Is) ? (++idxs[K - 2 - Is], moved = K - 2 - Is, true)
+                                                                      : false) ||
+                   ...);
+            if (moved == K) { return; }
+            ((void)(Is + 1 > moved && (idxs[Is + 1] = REP ? idxs[Is] : idxs[Is] + 1, true)), ...);
+        };
+        lam(std::make_index_sequence<K - 1>{});
+        return *this;
+    }
+    constexpr auto
+    operator--() -> _kcomb_idxIter & {
+        if (m_rank == m_total) {
+            _jump_to(m_rank - 1);
+            return *this;
+        }
+        --m_rank;
+        for (size_t i = K; i-- > 0;) {
+            if (idxs[i] != (i == 0 ? 0 : (REP ? idxs[i - 1] : idxs[i - 1] + 1))) {
+                --idxs[i];
+                for (size_t j = i + 1; j < K; ++j) { idxs[j] = static_cast<idx_type>(REP ? m_n - 1 : m_n - K + j); }
+                return *this;
+            }
+        }
+        return *this;
+    }
+    [[nodiscard]] constexpr auto
+    operator++(int) -> _kcomb_idxIter {
+        auto const pre = *this;
+        ++(*this);
+        return pre;
+    }
+    [[nodiscard]] constexpr auto
+    operator--(int) -> _kcomb_idxIter {
+        auto const pre = *this;
+        --(*this);
+        return pre;
+    }
+
+    constexpr auto
+    operator+=(difference_type diff) -> _kcomb_idxIter & {
+        _jump_to(static_cast<size_t>(static_cast<difference_type>(m_rank) + diff));
+        return *this;
+    }
+    constexpr auto
+    operator-=(difference_type diff) -> _kcomb_idxIter & {
+        return *this += -diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator+(_kcomb_idxIter it, difference_type diff) -> _kcomb_idxIter {
+        return it += diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator+(difference_type diff, _kcomb_idxIter it) -> _kcomb_idxIter {
+        return it += diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator-(_kcomb_idxIter it, difference_type diff) -> _kcomb_idxIter {
+        return it -= diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator-(_kcomb_idxIter const &lhs, _kcomb_idxIter const &rhs) -> difference_type {
+        return static_cast<difference_type>(lhs.m_rank) - static_cast<difference_type>(rhs.m_rank);
+    }
+
+    [[nodiscard]] constexpr auto
+    operator*() const -> reference {
+        return idxs;
+    }
+    [[nodiscard]] constexpr auto
+    operator[](difference_type diff) const -> reference {
+        return *(*this + diff);
+    }
+
+    [[nodiscard]] constexpr auto
+    operator==(_kcomb_idxIter const &other) const -> bool {
+        return m_rank == other.m_rank;
+    }
+    [[nodiscard]] constexpr auto
+    operator<=>(_kcomb_idxIter const &other) const {
+        return m_rank <=> other.m_rank;
+    }
+
+private:
+    constexpr void
+    _jump_to(size_t rank) {
+        m_rank = rank;
+        if (rank >= m_total) { return; }
+        if (rank != 0) { _throw_ifSaturated(m_total); }
+
+        std::array<size_t, K> unranked;
+        if (rank == 0) {
+            for (size_t i = 0; i < K; ++i) { unranked[i] = REP ? 0 : i; }
+        }
+        else if constexpr (REP) {
+            unranked = _unrank_combination<K>(m_n + K - 1, rank);
+            for (size_t i = 0; i < K; ++i) { unranked[i] -= i; }
+        }
+        else { unranked = _unrank_combination<K>(m_n, rank); }
+        for (size_t i = 0; i < K; ++i) { idxs[i] = static_cast<idx_type>(unranked[i]); }
+    }
+};
+
+// Plain nested loops over all the combinations whose first index is in [firstBegin, firstEnd), calls 'func(is...)'
+// The innermost loop is a simple counted loop with the outer indices fixed, the compiler can vectorize it (when 'func'
+// inlines)
+template <size_t K, bool REP, size_t DEPTH = 0, typename FUNC, typename... IDXs>
+constexpr void
+_kcomb_nestedLoops(size_t const from, size_t const to, size_t const n, FUNC &func, IDXs const... outer) {
+    if constexpr (DEPTH == K - 1) {
+        for (size_t i = from; i < to; ++i) { func(outer..., i); }
+    }
+    else {
+        for (size_t i = from; i < to; ++i) {
+            _kcomb_nestedLoops<K, REP, DEPTH + 1>(REP ? i : i + 1, REP ? n : n - (K - 2 - DEPTH), n, func, outer..., i);
+        }
+    }
+}
+
+template <size_t K, bool REP, typename FUNC>
+constexpr void
+_kcomb_forEach(size_t const n, size_t firstBegin, size_t firstEnd, FUNC &func) {
+    firstEnd = std::min(firstEnd, REP ? n : (n < K ? 0 : n - K + 1));
+    if (firstBegin < firstEnd) { _kcomb_nestedLoops<K, REP>(firstBegin, firstEnd, n, func); }
+}
+
+template <std::ranges::forward_range RANGE, size_t K, bool REP = false>
+requires std::ranges::view<RANGE> && (K > 1) && (not REP || _is_randomAccessSized<RANGE>)
+class _kcomb_view : public std::ranges::view_interface<_kcomb_view<RANGE, K, REP>> {
     RANGE base_;
 
 public:
@@ -106,32 +533,906 @@ public:
     [[nodiscard]] constexpr explicit _kcomb_view(RANGE range) : base_{std::move(range)} {}
 
     [[nodiscard]] constexpr auto
-    begin() const -> _kcomb_iter<RANGE, K> {
-        return _kcomb_iter<RANGE, K>{std::ranges::begin(base_), std::ranges::end(base_)};
+    begin() const {
+        if constexpr (_is_randomAccessSized<RANGE>) {
+            return _kcomb_raIter<RANGE, K, REP>{std::ranges::begin(base_), std::ranges::size(base_), 0};
+        }
+        else { return _kcomb_iter<RANGE, K>{std::ranges::begin(base_), std::ranges::end(base_)}; }
     }
 
     [[nodiscard]] constexpr auto
-    end() const -> _kcomb_sentinel<RANGE> {
-        return {};
+    end() const {
+        if constexpr (_is_randomAccessSized<RANGE>) {
+            return _kcomb_raIter<RANGE, K, REP>{std::ranges::begin(base_), std::ranges::size(base_), size()};
+        }
+        else { return _kcomb_sentinel<RANGE>{}; }
+    }
+
+    // Same combinations in the same order as iterating the view, as nested loops calling 'func(elems...)'
+    // Prefer this for hot kernels, the innermost loop can be vectorized
+    template <typename FUNC>
+    requires _is_randomAccessSized<RANGE>
+    constexpr void
+    for_each(FUNC &&func) const {
+        for_each(0, std::numeric_limits<size_t>::max(), std::forward<FUNC>(func));
+    }
+    // Only the combinations whose first element has index in [firstBegin, firstEnd) ... to split the work
+    template <typename FUNC>
+    requires _is_randomAccessSized<RANGE>
+    constexpr void
+    for_each(size_t const firstBegin, size_t const firstEnd, FUNC &&func) const {
+        // Raw pointer for contiguous ranges, the easiest for the vectorizer
+        auto const first = [&] {
+            if constexpr (std::ranges::contiguous_range<RANGE const>) { return std::ranges::data(base_); }
+            else { return std::ranges::begin(base_); }
+        }();
+        auto lam = [&](auto const... is) { func(first[is]...); };
+        _kcomb_forEach<K, REP>(std::ranges::size(base_), firstBegin, firstEnd, lam);
+    }
+
+    // C(n, K) or C(n + K - 1, K) with repetition, saturates at max size_t
+    [[nodiscard]] constexpr size_t
+    size() const
+    requires std::ranges::sized_range<RANGE const>
+    {
+        size_t const n = std::ranges::size(base_);
+        if constexpr (REP) { return n == 0 ? 0 : _binomial(n + K - 1, K); }
+        else { return _binomial(n, K); }
+    }
+
+    [[nodiscard]] constexpr auto
+    chunk(size_t const chunkSz) const
+    requires _is_randomAccessSized<RANGE>
+    {
+        return _chunked(*this, chunkSz);
     }
 };
 
 // template <std::ranges::sized_range RANGE>
 // combinations_k_view(RANGE &&) -> combinations_k_view<std::views::all_t<RANGE>, 2>;
 
-template <size_t K>
-struct _kcomb_fn : std::ranges::range_adaptor_closure<_kcomb_fn<K>> {
+template <size_t K, bool REP = false>
+struct _kcomb_fn : std::ranges::range_adaptor_closure<_kcomb_fn<K, REP>> {
     template <typename RANGE>
     constexpr auto
     operator()(RANGE &&range) const {
-        return _kcomb_view<std::views::all_t<RANGE>, K>{std::forward<RANGE>(range)};
+        return _kcomb_view<std::views::all_t<RANGE>, K, REP>{std::forward<RANGE>(range)};
+    }
+};
+
+// All K-combinations of the indices [0, n) as 'std::array<std::uint32_t, K>', no base range needed
+template <size_t K, bool REP = false>
+requires(K > 1)
+class _kcomb_idxView : public std::ranges::view_interface<_kcomb_idxView<K, REP>> {
+    size_t m_n = 0;
+
+public:
+    [[nodiscard]] constexpr _kcomb_idxView() = default;
+    [[nodiscard]] constexpr explicit _kcomb_idxView(size_t n) : m_n(n) {}
+
+    [[nodiscard]] constexpr auto
+    begin() const {
+        return _kcomb_idxIter<K, REP>{m_n, 0};
+    }
+    [[nodiscard]] constexpr auto
+    end() const {
+        return _kcomb_idxIter<K, REP>{m_n, size()};
+    }
+
+    [[nodiscard]] constexpr size_t
+    size() const {
+        if constexpr (REP) { return m_n == 0 ? 0 : _binomial(m_n + K - 1, K); }
+        else { return _binomial(m_n, K); }
+    }
+
+    [[nodiscard]] constexpr auto
+    chunk(size_t const chunkSz) const {
+        return _chunked(*this, chunkSz);
+    }
+
+    // Nested loops calling 'func(is...)' with 'size_t' indices, see '_kcomb_view::for_each'
+    template <typename FUNC>
+    constexpr void
+    for_each(FUNC &&func) const {
+        _kcomb_forEach<K, REP>(m_n, 0, std::numeric_limits<size_t>::max(), func);
+    }
+    template <typename FUNC>
+    constexpr void
+    for_each(size_t const firstBegin, size_t const firstEnd, FUNC &&func) const {
+        _kcomb_forEach<K, REP>(m_n, firstBegin, firstEnd, func);
+    }
+};
+
+template <size_t K, bool REP = false>
+struct _kcomb_idxFn {
+    constexpr auto
+    operator()(size_t const n) const {
+        return _kcomb_idxView<K, REP>{n};
+    }
+};
+
+
+// PERMUTATIONS
+// Arrangements of the elements by position, duplicate elements are not collapsed (same as 'std::next_permutation' over
+// indices). n! only fits into 'size_t' up to n = 20
+inline constexpr size_t c_maxPermutationSz = 20;
+
+constexpr size_t
+_factorial(size_t const n) noexcept {
+    size_t res = 1;
+    for (size_t i = 2; i <= n; ++i) {
+        if (res > std::numeric_limits<size_t>::max() / i) { return std::numeric_limits<size_t>::max(); }
+        res *= i;
+    }
+    return res;
+}
+
+using _PermIdxs = std::array<std::uint8_t, c_maxPermutationSz>;
+
+// Indices of the 'rank'-th (lexicographically) permutation of 'n', decodes 'rank' in the factorial number system
+// (Lehmer code)
+constexpr _PermIdxs
+_unrank_permutation(size_t const n, size_t rank) noexcept {
+    _PermIdxs res{};
+    _PermIdxs left{};
+    for (size_t i = 0; i < n; ++i) { left[i] = static_cast<std::uint8_t>(i); }
+    for (size_t i = 0; i < n; ++i) {
+        size_t const fact = _factorial(n - 1 - i);
+        size_t const pick = rank / fact;
+        rank             %= fact;
+        res[i]            = left[pick];
+        std::ranges::copy(left.begin() + pick + 1, left.begin() + n - i, left.begin() + pick);
+    }
+    return res;
+}
+
+// Maps a position of the arrangement to the element of the base range
+template <typename BaseIt>
+struct _ArrangementAt {
+    BaseIt    begin{};
+    _PermIdxs idxs{};
+
+    [[nodiscard]] constexpr decltype(auto)
+    operator()(std::uint32_t const pos) const {
+        return begin[idxs[pos]];
+    }
+};
+
+// One arrangement, a lazy view of references into the base range
+// 32bit positions, 'iota_view' of 'size_t' can have an integer-class difference type (not a Cpp17 iterator then)
+template <typename BaseIt>
+using _Arrangement =
+    std::ranges::transform_view<std::ranges::iota_view<std::uint32_t, std::uint32_t>, _ArrangementAt<BaseIt>>;
+
+template <typename BaseIt>
+constexpr _Arrangement<BaseIt>
+_make_arrangement(BaseIt begin, _PermIdxs const &idxs, size_t const n) {
+    return _Arrangement<BaseIt>{std::views::iota(0u, static_cast<std::uint32_t>(n)),
+                                _ArrangementAt<BaseIt>{begin, idxs}};
+}
+
+// Lexicographic order, random access through unranking
+template <std::ranges::random_access_range RANGE>
+class _perm_raIter {
+    using base_iterator = std::ranges::iterator_t<RANGE const>;
+
+    _PermIdxs     idxs{};
+    base_iterator m_begin{};
+    size_t        m_n     = 0;
+    size_t        m_total = 0;
+    size_t        m_rank  = 0;
+
+public:
+    using value_type        = _Arrangement<base_iterator>;
+    using reference         = value_type;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    [[nodiscard]] constexpr _perm_raIter() = default;
+
+    [[nodiscard]] constexpr _perm_raIter(base_iterator begin, size_t n, size_t rank)
+        : m_begin(begin), m_n(n), m_total(_factorial(n)) {
+        _jump_to(rank);
+    }
+
+    [[nodiscard]] constexpr size_t
+    rank() const noexcept {
+        return m_rank;
+    }
+    // Indices into the base range of the current arrangement
+    [[nodiscard]] constexpr std::span<std::uint8_t const>
+    indices() const noexcept {
+        return {idxs.data(), m_n};
+    }
+
+    // Amortized O(1)
+    constexpr auto
+    operator++() -> _perm_raIter & {
+        ++m_rank;
+        std::next_permutation(idxs.begin(), idxs.begin() + m_n);
+        return *this;
+    }
+    constexpr auto
+    operator--() -> _perm_raIter & {
+        if (m_rank == m_total) { _jump_to(m_rank - 1); }
+        else {
+            --m_rank;
+            std::prev_permutation(idxs.begin(), idxs.begin() + m_n);
+        }
+        return *this;
+    }
+    [[nodiscard]] constexpr auto
+    operator++(int) -> _perm_raIter {
+        auto const pre = *this;
+        ++(*this);
+        return pre;
+    }
+    [[nodiscard]] constexpr auto
+    operator--(int) -> _perm_raIter {
+        auto const pre = *this;
+        --(*this);
+        return pre;
+    }
+
+    constexpr auto
+    operator+=(difference_type diff) -> _perm_raIter & {
+        _jump_to(static_cast<size_t>(static_cast<difference_type>(m_rank) + diff));
+        return *this;
+    }
+    constexpr auto
+    operator-=(difference_type diff) -> _perm_raIter & {
+        return *this += -diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator+(_perm_raIter it, difference_type diff) -> _perm_raIter {
+        return it += diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator+(difference_type diff, _perm_raIter it) -> _perm_raIter {
+        return it += diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator-(_perm_raIter it, difference_type diff) -> _perm_raIter {
+        return it -= diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator-(_perm_raIter const &lhs, _perm_raIter const &rhs) -> difference_type {
+        return static_cast<difference_type>(lhs.m_rank) - static_cast<difference_type>(rhs.m_rank);
+    }
+
+    [[nodiscard]] constexpr auto
+    operator*() const -> reference {
+        return _make_arrangement(m_begin, idxs, m_n);
+    }
+    [[nodiscard]] constexpr auto
+    operator[](difference_type diff) const -> reference {
+        return *(*this + diff);
+    }
+
+    [[nodiscard]] constexpr auto
+    operator==(_perm_raIter const &other) const -> bool {
+        return m_rank == other.m_rank;
+    }
+    [[nodiscard]] constexpr auto
+    operator<=>(_perm_raIter const &other) const {
+        return m_rank <=> other.m_rank;
+    }
+
+private:
+    constexpr void
+    _jump_to(size_t rank) noexcept {
+        m_rank = rank;
+        if (rank >= m_total) { return; }
+        if (rank == 0) {
+            for (size_t i = 0; i < m_n; ++i) { idxs[i] = static_cast<std::uint8_t>(i); }
+        }
+        else { idxs = _unrank_permutation(m_n, rank); }
+    }
+};
+
+// Heap's algorithm (iterative), consecutive arrangements differ by exactly one swap
+// Forward only, the order has no cheap unranking
+template <std::ranges::random_access_range RANGE>
+class _perm_heapIter {
+    using base_iterator = std::ranges::iterator_t<RANGE const>;
+
+    _PermIdxs     idxs{};
+    _PermIdxs     counters{};
+    base_iterator m_begin{};
+    size_t        m_n     = 0;
+    size_t        m_total = 0;
+    size_t        m_rank  = 0;
+    std::uint8_t  m_swapA = 0;
+    std::uint8_t  m_swapB = 0;
+
+public:
+    using value_type        = _Arrangement<base_iterator>;
+    using reference         = value_type;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    [[nodiscard]] constexpr _perm_heapIter() = default;
+
+    [[nodiscard]] constexpr _perm_heapIter(base_iterator begin, size_t n)
+        : m_begin(begin), m_n(n), m_total(_factorial(n)) {
+        for (size_t i = 0; i < n; ++i) { idxs[i] = static_cast<std::uint8_t>(i); }
+    }
+
+    [[nodiscard]] constexpr size_t
+    rank() const noexcept {
+        return m_rank;
+    }
+    [[nodiscard]] constexpr std::span<std::uint8_t const>
+    indices() const noexcept {
+        return {idxs.data(), m_n};
+    }
+    // Positions swapped by the last increment
+    [[nodiscard]] constexpr std::pair<size_t, size_t>
+    lastSwap() const noexcept {
+        return {m_swapA, m_swapB};
+    }
+
+    // Amortized O(1)
+    constexpr auto
+    operator++() -> _perm_heapIter & {
+        ++m_rank;
+        for (size_t lvl = 1; lvl < m_n; ++lvl) {
+            if (counters[lvl] < lvl) {
+                m_swapA = (lvl % 2 == 0) ? 0 : counters[lvl];
+                m_swapB = static_cast<std::uint8_t>(lvl);
+                std::swap(idxs[m_swapA], idxs[m_swapB]);
+                ++counters[lvl];
+                return *this;
+            }
+            counters[lvl] = 0;
+        }
+        return *this;
+    }
+    [[nodiscard]] constexpr auto
+    operator++(int) -> _perm_heapIter {
+        auto const pre = *this;
+        ++(*this);
+        return pre;
+    }
+
+    [[nodiscard]] constexpr auto
+    operator*() const -> reference {
+        return _make_arrangement(m_begin, idxs, m_n);
+    }
+
+    [[nodiscard]] constexpr auto
+    operator==(_perm_heapIter const &other) const -> bool {
+        return m_rank == other.m_rank;
+    }
+    [[nodiscard]] constexpr auto
+    operator==(std::default_sentinel_t) const -> bool {
+        return m_rank >= m_total;
+    }
+};
+
+template <std::ranges::random_access_range RANGE, bool HEAP>
+requires std::ranges::view<RANGE> && _is_randomAccessSized<RANGE>
+class _perm_view : public std::ranges::view_interface<_perm_view<RANGE, HEAP>> {
+    RANGE base_;
+
+public:
+    [[nodiscard]] constexpr _perm_view() = default;
+
+    [[nodiscard]] constexpr explicit _perm_view(RANGE range) : base_{std::move(range)} {
+        if (std::ranges::size(base_) > c_maxPermutationSz) {
+            throw std::length_error("Permutations: more than 20 elements, n! would not fit into size_t");
+        }
+    }
+
+    [[nodiscard]] constexpr auto
+    begin() const {
+        if constexpr (HEAP) { return _perm_heapIter<RANGE>{std::ranges::begin(base_), std::ranges::size(base_)}; }
+        else { return _perm_raIter<RANGE>{std::ranges::begin(base_), std::ranges::size(base_), 0}; }
+    }
+
+    [[nodiscard]] constexpr auto
+    end() const {
+        if constexpr (HEAP) { return std::default_sentinel; }
+        else { return _perm_raIter<RANGE>{std::ranges::begin(base_), std::ranges::size(base_), size()}; }
+    }
+
+    [[nodiscard]] constexpr size_t
+    size() const {
+        return _factorial(std::ranges::size(base_));
+    }
+
+    [[nodiscard]] constexpr auto
+    chunk(size_t const chunkSz) const
+    requires(not HEAP)
+    {
+        return _chunked(*this, chunkSz);
+    }
+};
+
+template <typename RANGE>
+using _perm_lexView = _perm_view<RANGE, false>;
+template <typename RANGE>
+using _perm_heapView = _perm_view<RANGE, true>;
+
+
+// POWERSET
+// One subset, a view of references to the elements whose bits are set in 'mask'
+template <typename BaseIt>
+class _Subset : public std::ranges::view_interface<_Subset<BaseIt>> {
+    BaseIt        m_begin{};
+    std::uint64_t m_mask = 0;
+
+public:
+    class iterator {
+        BaseIt        m_begin{};
+        std::uint64_t m_left = 0;
+
+    public:
+        using value_type        = std::iter_value_t<BaseIt>;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        [[nodiscard]] constexpr iterator() = default;
+        [[nodiscard]] constexpr iterator(BaseIt begin, std::uint64_t mask) : m_begin(begin), m_left(mask) {}
+
+        [[nodiscard]] constexpr decltype(auto)
+        operator*() const {
+            return m_begin[std::countr_zero(m_left)];
+        }
+        constexpr auto
+        operator++() -> iterator & {
+            m_left &= m_left - 1;
+            return *this;
+        }
+        [[nodiscard]] constexpr auto
+        operator++(int) -> iterator {
+            auto const pre = *this;
+            ++(*this);
+            return pre;
+        }
+
+        [[nodiscard]] constexpr auto
+        operator==(iterator const &other) const -> bool {
+            return m_left == other.m_left;
+        }
+        [[nodiscard]] constexpr auto
+        operator==(std::default_sentinel_t) const -> bool {
+            return m_left == 0;
+        }
+    };
+
+    [[nodiscard]] constexpr _Subset() = default;
+    [[nodiscard]] constexpr _Subset(BaseIt begin, std::uint64_t mask) : m_begin(begin), m_mask(mask) {}
+
+    [[nodiscard]] constexpr iterator
+    begin() const {
+        return {m_begin, m_mask};
+    }
+    [[nodiscard]] constexpr std::default_sentinel_t
+    end() const {
+        return {};
+    }
+    [[nodiscard]] constexpr size_t
+    size() const {
+        return static_cast<size_t>(std::popcount(m_mask));
+    }
+    // Bit i set means the i-th element of the base range is in the subset
+    [[nodiscard]] constexpr std::uint64_t
+    mask() const noexcept {
+        return m_mask;
+    }
+};
+
+// 2^n has to fit into ptrdiff_t (differences of the iterators)
+inline constexpr size_t c_maxPowersetSz = 62;
+
+// Reflected binary Gray code of the rank, consecutive subsets differ by exactly one element
+template <std::ranges::random_access_range RANGE>
+class _powerset_iter {
+    using base_iterator = std::ranges::iterator_t<RANGE const>;
+
+    base_iterator m_begin{};
+    size_t        m_rank = 0;
+
+public:
+    using value_type        = _Subset<base_iterator>;
+    using reference         = value_type;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    [[nodiscard]] constexpr _powerset_iter() = default;
+    [[nodiscard]] constexpr _powerset_iter(base_iterator begin, size_t rank) : m_begin(begin), m_rank(rank) {}
+
+    [[nodiscard]] constexpr size_t
+    rank() const noexcept {
+        return m_rank;
+    }
+    [[nodiscard]] constexpr std::uint64_t
+    mask() const noexcept {
+        return m_rank ^ (m_rank >> 1);
+    }
+    // Index of the element added or removed by the last increment (only meaningful for rank > 0)
+    [[nodiscard]] constexpr size_t
+    changed() const noexcept {
+        return static_cast<size_t>(std::countr_zero(m_rank));
+    }
+
+    constexpr auto
+    operator++() -> _powerset_iter & {
+        ++m_rank;
+        return *this;
+    }
+    constexpr auto
+    operator--() -> _powerset_iter & {
+        --m_rank;
+        return *this;
+    }
+    [[nodiscard]] constexpr auto
+    operator++(int) -> _powerset_iter {
+        auto const pre = *this;
+        ++(*this);
+        return pre;
+    }
+    [[nodiscard]] constexpr auto
+    operator--(int) -> _powerset_iter {
+        auto const pre = *this;
+        --(*this);
+        return pre;
+    }
+
+    constexpr auto
+    operator+=(difference_type diff) -> _powerset_iter & {
+        m_rank = static_cast<size_t>(static_cast<difference_type>(m_rank) + diff);
+        return *this;
+    }
+    constexpr auto
+    operator-=(difference_type diff) -> _powerset_iter & {
+        return *this += -diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator+(_powerset_iter it, difference_type diff) -> _powerset_iter {
+        return it += diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator+(difference_type diff, _powerset_iter it) -> _powerset_iter {
+        return it += diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator-(_powerset_iter it, difference_type diff) -> _powerset_iter {
+        return it -= diff;
+    }
+    [[nodiscard]] constexpr friend auto
+    operator-(_powerset_iter const &lhs, _powerset_iter const &rhs) -> difference_type {
+        return static_cast<difference_type>(lhs.m_rank) - static_cast<difference_type>(rhs.m_rank);
+    }
+
+    [[nodiscard]] constexpr auto
+    operator*() const -> reference {
+        return {m_begin, mask()};
+    }
+    [[nodiscard]] constexpr auto
+    operator[](difference_type diff) const -> reference {
+        return *(*this + diff);
+    }
+
+    [[nodiscard]] constexpr auto
+    operator==(_powerset_iter const &other) const -> bool {
+        return m_rank == other.m_rank;
+    }
+    [[nodiscard]] constexpr auto
+    operator<=>(_powerset_iter const &other) const {
+        return m_rank <=> other.m_rank;
+    }
+};
+
+template <std::ranges::random_access_range RANGE>
+requires std::ranges::view<RANGE> && _is_randomAccessSized<RANGE>
+class _powerset_view : public std::ranges::view_interface<_powerset_view<RANGE>> {
+    RANGE base_;
+
+public:
+    [[nodiscard]] constexpr _powerset_view() = default;
+
+    [[nodiscard]] constexpr explicit _powerset_view(RANGE range) : base_{std::move(range)} {
+        if (std::ranges::size(base_) > c_maxPowersetSz) {
+            throw std::length_error("Powerset: more than 62 elements, 2^n would not fit into ptrdiff_t");
+        }
+    }
+
+    [[nodiscard]] constexpr auto
+    begin() const {
+        return _powerset_iter<RANGE>{std::ranges::begin(base_), 0};
+    }
+    [[nodiscard]] constexpr auto
+    end() const {
+        return _powerset_iter<RANGE>{std::ranges::begin(base_), size()};
+    }
+
+    [[nodiscard]] constexpr size_t
+    size() const {
+        return 1uz << std::ranges::size(base_);
+    }
+
+    [[nodiscard]] constexpr auto
+    chunk(size_t const chunkSz) const {
+        return _chunked(*this, chunkSz);
+    }
+};
+
+
+// CARTESIAN PRODUCT
+// Same order as nested loops, the last range is the innermost one
+// Random access when all the ranges are random access and sized, the position is then a mixed radix number
+template <std::ranges::forward_range... RNGs>
+requires(sizeof...(RNGs) > 0 && (std::ranges::view<RNGs> && ...))
+class _product_view : public std::ranges::view_interface<_product_view<RNGs...>> {
+    std::tuple<RNGs...> bases_;
+
+    static constexpr bool c_randomAccess = (_is_randomAccessSized<RNGs> && ...);
+    static constexpr auto idxSeq         = std::make_index_sequence<sizeof...(RNGs)>{};
+
+    class iterator {
+        _product_view const                              *m_parent = nullptr;
+        std::tuple<std::ranges::iterator_t<RNGs const>...> iters;
+
+    public:
+        using value_type        = std::tuple<std::ranges::range_value_t<RNGs const>...>;
+        using reference         = std::tuple<std::ranges::range_reference_t<RNGs const>...>;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+        using iterator_concept =
+            std::conditional_t<c_randomAccess, std::random_access_iterator_tag, std::forward_iterator_tag>;
+
+        [[nodiscard]] constexpr iterator() = default;
+        [[nodiscard]] constexpr iterator(_product_view const *parent,
+                                         std::tuple<std::ranges::iterator_t<RNGs const>...> its)
+            : m_parent(parent), iters(std::move(its)) {}
+
+        // Carries into the previous range when one wraps around, the first one never wraps
+        constexpr auto
+        operator++() -> iterator & {
+            _increment<sizeof...(RNGs) - 1>();
+            return *this;
+        }
+        [[nodiscard]] constexpr auto
+        operator++(int) -> iterator {
+            auto const pre = *this;
+            ++(*this);
+            return pre;
+        }
+        constexpr auto
+        operator--() -> iterator &
+        requires c_randomAccess
+        {
+            return *this -= 1;
+        }
+        [[nodiscard]] constexpr auto
+        operator--(int) -> iterator
+        requires c_randomAccess
+        {
+            auto const pre = *this;
+            --(*this);
+            return pre;
+        }
+
+        constexpr auto
+        operator+=(difference_type diff) -> iterator &
+        requires c_randomAccess
+        {
+            _jump_to(static_cast<size_t>(static_cast<difference_type>(_rank()) + diff));
+            return *this;
+        }
+        constexpr auto
+        operator-=(difference_type diff) -> iterator &
+        requires c_randomAccess
+        {
+            return *this += -diff;
+        }
+        [[nodiscard]] constexpr friend auto
+        operator+(iterator it, difference_type diff) -> iterator
+        requires c_randomAccess
+        {
+            return it += diff;
+        }
+        [[nodiscard]] constexpr friend auto
+        operator+(difference_type diff, iterator it) -> iterator
+        requires c_randomAccess
+        {
+            return it += diff;
+        }
+        [[nodiscard]] constexpr friend auto
+        operator-(iterator it, difference_type diff) -> iterator
+        requires c_randomAccess
+        {
+            return it -= diff;
+        }
+        [[nodiscard]] constexpr friend auto
+        operator-(iterator const &lhs, iterator const &rhs) -> difference_type
+        requires c_randomAccess
+        {
+            return static_cast<difference_type>(lhs._rank()) - static_cast<difference_type>(rhs._rank());
+        }
+
+        [[nodiscard]] constexpr auto
+        operator*() const -> reference {
+            return std::apply([](auto const &...its) { return reference{*its...}; }, iters);
+        }
+        [[nodiscard]] constexpr auto
+        operator[](difference_type diff) const -> reference
+        requires c_randomAccess
+        {
+            return *(*this + diff);
+        }
+
+        [[nodiscard]] constexpr auto
+        operator==(iterator const &other) const -> bool {
+            return iters == other.iters;
+        }
+        [[nodiscard]] constexpr auto
+        operator<=>(iterator const &other) const
+        requires c_randomAccess
+        {
+            return _rank() <=> other._rank();
+        }
+
+    private:
+        template <size_t I>
+        constexpr void
+        _increment() {
+            auto &it = std::get<I>(iters);
+            ++it;
+            if constexpr (I > 0) {
+                if (it == std::ranges::end(std::get<I>(m_parent->bases_))) {
+                    it = std::ranges::begin(std::get<I>(m_parent->bases_));
+                    _increment<I - 1>();
+                }
+            }
+        }
+
+        constexpr size_t
+        _rank() const {
+            auto lam = [&]<size_t... Is>(std::index_sequence<Is...>) -> size_t {
+                size_t res = 0;
+                ((res = res * std::ranges::size(std::get<Is>(m_parent->bases_)) +
+                        static_cast<size_t>(std::get<Is>(iters) - std::ranges::begin(std::get<Is>(m_parent->bases_)))),
+                 ...);
+                return res;
+            };
+            return lam(idxSeq);
+        }
+        constexpr void
+        _jump_to(size_t rank) {
+            auto lam = [&]<size_t... Is>(std::index_sequence<Is...>) -> void {
+                // From the innermost (last) range outwards, the first one takes whatever is left (the end is n_0)
+                (
+                    [&] {
+                        constexpr size_t I    = sizeof...(RNGs) - 1 - Is;
+                        auto const      &base = std::get<I>(m_parent->bases_);
+                        size_t           pos  = rank;
+                        if constexpr (I > 0) {
+                            size_t const sz = std::ranges::size(base);
+                            pos             = rank % sz;
+                            rank           /= sz;
+                        }
+                        std::get<I>(iters) = std::ranges::begin(base) + static_cast<difference_type>(pos);
+                    }(),
+                    ...);
+            };
+            lam(idxSeq);
+        }
+    };
+
+public:
+    [[nodiscard]] constexpr _product_view() = default;
+    [[nodiscard]] constexpr explicit _product_view(RNGs... rngs) : bases_{std::move(rngs)...} {}
+
+    [[nodiscard]] constexpr iterator
+    begin() const {
+        return {this, std::apply([](auto const &...bases) { return std::tuple{std::ranges::begin(bases)...}; },
+                                 bases_)};
+    }
+
+    // The first range at its end and the rest at their beginnings ... or everything at the beginning when any of the
+    // ranges is empty, then 'begin() == end()'
+    [[nodiscard]] constexpr iterator
+    end() const {
+        iterator res = begin();
+        if (std::apply([](auto const &...bases) { return (std::ranges::empty(bases) || ...); }, bases_)) { return res; }
+        auto const &first = std::get<0>(bases_);
+        return {this, std::apply(
+                          [&](auto const &, auto const &...rest) {
+                              return std::tuple{std::ranges::next(std::ranges::begin(first), std::ranges::end(first)),
+                                                std::ranges::begin(rest)...};
+                          },
+                          bases_)};
+    }
+
+    // Saturates at max size_t
+    [[nodiscard]] constexpr size_t
+    size() const
+    requires(std::ranges::sized_range<RNGs const> && ...)
+    {
+        return std::apply(
+            [](auto const &...bases) {
+                size_t res = 1;
+                ((res = (std::ranges::size(bases) != 0 &&
+                         res > std::numeric_limits<size_t>::max() / std::ranges::size(bases))
+                            ? std::numeric_limits<size_t>::max()
+                            : res * std::ranges::size(bases)),
+                 ...);
+                return res;
+            },
+            bases_);
+    }
+
+    [[nodiscard]] constexpr auto
+    chunk(size_t const chunkSz) const
+    requires c_randomAccess
+    {
+        return _chunked(*this, chunkSz);
+    }
+};
+
+
+template <template <typename> typename VIEW>
+struct _view_fn : std::ranges::range_adaptor_closure<_view_fn<VIEW>> {
+    template <typename RANGE>
+    constexpr auto
+    operator()(RANGE &&range) const {
+        return VIEW<std::views::all_t<RANGE>>{std::forward<RANGE>(range)};
+    }
+};
+
+// Factory rather than an adaptor closure ... it takes any number of ranges, same as 'std::views::cartesian_product'
+struct _product_fn {
+    template <std::ranges::viewable_range... RNGs>
+    requires(sizeof...(RNGs) > 0)
+    constexpr auto
+    operator()(RNGs &&...rngs) const {
+        return _product_view<std::views::all_t<RNGs>...>{std::views::all(std::forward<RNGs>(rngs))...};
     }
 };
 } // namespace detail
 
+// All K-combinations (as tuples of references) of the elements of a range, in lexicographic order of their indices
+// Over random access sized ranges the view is random access and sized too, 'view[m]' is the m-th combination and
+// 'view.chunk(n)' splits it into independent chunks of n combinations (eg. one or more per thread)
+// Jumping and chunking need the count to fit into size_t (they throw 'std::overflow_error' otherwise)
+// 'view.for_each(func)' calls 'func(elems...)' from plain nested loops, the fastest way through all of them (the
+// innermost loop can be vectorized)
 template <size_t K>
 requires(K > 1)
 constexpr inline detail::_kcomb_fn<K> combinations_k;
 
+// All K-combinations of the indices [0, n) as 'std::array<std::uint32_t, K>' in lexicographic order
+// Random access and sized with 'view.chunk(n)', 'view.for_each(func)' runs them as nested loops
+template <size_t K>
+requires(K > 1)
+constexpr inline detail::_kcomb_idxFn<K> combinations_k_indices;
+
+// All K-multicombinations (elements can repeat, 'C(n + K - 1, K)' of them) in lexicographic order of their indices
+// Random access sized ranges only, the view is random access and sized and has 'view.chunk(n)' as well
+template <size_t K>
+requires(K > 1)
+constexpr inline detail::_kcomb_fn<K, true> combinations_rep_k;
+
+// All arrangements of the elements (of positions, duplicates included) in lexicographic order of their indices
+// Each one is a lazy view of references, the view is random access and sized ('view[m]', 'view.chunk(n)')
+// Up to 20 elements (n! has to fit into size_t), throws 'std::length_error' for more
+constexpr inline detail::_view_fn<detail::_perm_lexView> permutations;
+
+// Same arrangements as 'permutations' in the order of Heap's algorithm, consecutive ones differ by a single swap
+// ('it.lastSwap()'), forward only
+constexpr inline detail::_view_fn<detail::_perm_heapView> permutations_heap;
+
+// All 2^n subsets in Gray code order (starting with the empty one), consecutive ones differ by a single element
+// ('it.changed()'). Each one is a lazy view of references with 'mask()', the view is random access and sized
+// Up to 62 elements (2^n has to fit into ptrdiff_t), throws 'std::length_error' for more
+constexpr inline detail::_view_fn<detail::_powerset_view> powerset;
+
+// Cartesian product of any number of (possibly different) forward ranges as tuples of references, the last range
+// varies fastest. Random access and sized with 'view.chunk(n)' when all the ranges are random access and sized
+constexpr inline detail::_product_fn product;
+
 
 } // namespace incom::standard::views
\ No newline at end of file
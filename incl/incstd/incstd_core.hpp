@@ -1,6 +1,7 @@
 #pragma once
 
 #include <incstd/core/algos.hpp>
+#include <incstd/core/allocators.hpp>
 #include <incstd/core/argpack.hpp>
 #include <incstd/core/buffers.hpp>
 #include <incstd/core/combinators.hpp>